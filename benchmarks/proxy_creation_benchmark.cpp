@@ -1,11 +1,14 @@
 // Copyright (c) Microsoft Corporation.
 // Licensed under the MIT License.
 
+#include <algorithm>
 #include <any>
 #include <array>
+#include <chrono>
 #include <memory_resource>
 #include <mutex>
 #include <string>
+#include <thread>
 
 #include <benchmark/benchmark.h>
 
@@ -28,6 +31,11 @@ namespace {
 
 constexpr int TestManagedObjectCount = 600000;
 constexpr int TypeSeriesCount = 3;
+// Few enough objects per thread for all threads to stay in cache, so that
+// multi-threaded benchmarks measure reference counting rather than memory
+// bandwidth
+constexpr int TestHotObjectCount = 6000;
+constexpr int TestReleasedObjectCount = 1000;
 
 using SmallObject1 = int;
 using SmallObject2 = double;
@@ -48,6 +56,16 @@ struct LargeObject3 {
   void* Padding[15];
 };
 
+// Objects of different sizes so that a growing inline buffer absorbs one more
+// type of the series at each of 32, 64 and 128 bytes
+using MixedObject1 = std::array<char, 24>;
+using MixedObject2 = std::array<char, 56>;
+using MixedObject3 = std::array<char, 120>;
+
+// An object that is expensive to destroy, so that the latency of releasing the
+// last reference depends on whether it is destroyed right away
+using HeavyObject = std::vector<std::string>;
+
 struct PolymorphicObjectBase {
   virtual ~PolymorphicObjectBase() = default;
 };
@@ -61,6 +79,38 @@ struct DefaultFacade : pro::facade_builder                               //
                        ::add_skill<pro::skills::slim>                    //
                        ::build {};
 
+struct ThreadCachingFacade : pro::facade_builder                      //
+                             ::add_facade<DefaultFacade>              //
+                             ::add_skill<pro::skills::thread_caching> //
+                             ::build {};
+
+struct CowFacade : pro::facade_builder           //
+                   ::add_facade<DefaultFacade>   //
+                   ::add_skill<pro::skills::cow> //
+                   ::build {};
+
+struct ViewableFacade : pro::facade_builder               //
+                        ::add_facade<DefaultFacade>       //
+                        ::add_skill<pro::skills::as_view> //
+                        ::build {};
+
+struct WeakFacade : pro::facade_builder               //
+                    ::add_facade<DefaultFacade>       //
+                    ::add_skill<pro::skills::as_weak> //
+                    ::build {};
+
+struct SharedFacade : pro::facade_builder                        //
+                      ::add_facade<DefaultFacade>                //
+                      ::add_skill<pro::skills::shared_ownership> //
+                      ::build {};
+
+template <std::size_t Size>
+struct SmallBufferFacade
+    : pro::facade_builder                               //
+      ::support_copy<pro::constraint_level::nontrivial> //
+      ::small_buffer<Size>                              //
+      ::build {};
+
 void BM_SmallObjectCreationWithProxy(benchmark::State& state) {
   for (auto _ : state) {
     std::vector<pro::proxy<DefaultFacade>> data;
@@ -87,6 +137,302 @@ void BM_SmallObjectCreationWithProxy_Shared(benchmark::State& state) {
   }
 }
 
+void BM_SmallObjectCreationWithProxy_SharedLocal(benchmark::State& state) {
+  for (auto _ : state) {
+    std::vector<pro::proxy<DefaultFacade>> data;
+    data.reserve(TestManagedObjectCount);
+    for (int i = 0; i < TestManagedObjectCount; i += TypeSeriesCount) {
+      data.push_back(
+          pro::make_proxy_shared_local<DefaultFacade, SmallObject1>());
+      data.push_back(
+          pro::make_proxy_shared_local<DefaultFacade, SmallObject2>());
+      data.push_back(
+          pro::make_proxy_shared_local<DefaultFacade, SmallObject3>());
+    }
+    benchmark::DoNotOptimize(data);
+  }
+}
+
+void BM_SmallObjectCreationWithProxy_SharedBiased(benchmark::State& state) {
+  for (auto _ : state) {
+    std::vector<pro::proxy<DefaultFacade>> data;
+    data.reserve(TestManagedObjectCount);
+    for (int i = 0; i < TestManagedObjectCount; i += TypeSeriesCount) {
+      data.push_back(
+          pro::make_proxy_shared_biased<DefaultFacade, SmallObject1>());
+      data.push_back(
+          pro::make_proxy_shared_biased<DefaultFacade, SmallObject2>());
+      data.push_back(
+          pro::make_proxy_shared_biased<DefaultFacade, SmallObject3>());
+    }
+    benchmark::DoNotOptimize(data);
+  }
+}
+
+void BM_SmallObjectCopyWithProxy_Shared(benchmark::State& state) {
+  std::vector<pro::proxy<DefaultFacade>> data;
+  data.reserve(TestManagedObjectCount);
+  for (int i = 0; i < TestManagedObjectCount; i += TypeSeriesCount) {
+    data.push_back(pro::make_proxy_shared<DefaultFacade, SmallObject1>());
+    data.push_back(pro::make_proxy_shared<DefaultFacade, SmallObject2>());
+    data.push_back(pro::make_proxy_shared<DefaultFacade, SmallObject3>());
+  }
+  for (auto _ : state) {
+    std::vector<pro::proxy<DefaultFacade>> copy = data;
+    benchmark::DoNotOptimize(copy);
+  }
+}
+
+void BM_SmallObjectCopyWithProxy_SharedLocal(benchmark::State& state) {
+  std::vector<pro::proxy<DefaultFacade>> data;
+  data.reserve(TestManagedObjectCount);
+  for (int i = 0; i < TestManagedObjectCount; i += TypeSeriesCount) {
+    data.push_back(
+        pro::make_proxy_shared_local<DefaultFacade, SmallObject1>());
+    data.push_back(
+        pro::make_proxy_shared_local<DefaultFacade, SmallObject2>());
+    data.push_back(
+        pro::make_proxy_shared_local<DefaultFacade, SmallObject3>());
+  }
+  for (auto _ : state) {
+    std::vector<pro::proxy<DefaultFacade>> copy = data;
+    benchmark::DoNotOptimize(copy);
+  }
+}
+
+void BM_SmallObjectCopyWithProxy_SharedBiased(benchmark::State& state) {
+  std::vector<pro::proxy<DefaultFacade>> data;
+  data.reserve(TestManagedObjectCount);
+  for (int i = 0; i < TestManagedObjectCount; i += TypeSeriesCount) {
+    data.push_back(
+        pro::make_proxy_shared_biased<DefaultFacade, SmallObject1>());
+    data.push_back(
+        pro::make_proxy_shared_biased<DefaultFacade, SmallObject2>());
+    data.push_back(
+        pro::make_proxy_shared_biased<DefaultFacade, SmallObject3>());
+  }
+  for (auto _ : state) {
+    std::vector<pro::proxy<DefaultFacade>> copy = data;
+    benchmark::DoNotOptimize(copy);
+  }
+}
+
+void BM_HotSmallObjectCopyWithProxy_Shared(benchmark::State& state) {
+  std::vector<pro::proxy<DefaultFacade>> data;
+  data.reserve(TestHotObjectCount);
+  for (int i = 0; i < TestHotObjectCount; i += TypeSeriesCount) {
+    data.push_back(pro::make_proxy_shared<DefaultFacade, SmallObject1>());
+    data.push_back(pro::make_proxy_shared<DefaultFacade, SmallObject2>());
+    data.push_back(pro::make_proxy_shared<DefaultFacade, SmallObject3>());
+  }
+  for (auto _ : state) {
+    std::vector<pro::proxy<DefaultFacade>> copy = data;
+    benchmark::DoNotOptimize(copy);
+  }
+}
+
+void BM_HotSmallObjectCopyWithProxy_SharedBiased(benchmark::State& state) {
+  std::vector<pro::proxy<DefaultFacade>> data;
+  data.reserve(TestHotObjectCount);
+  for (int i = 0; i < TestHotObjectCount; i += TypeSeriesCount) {
+    data.push_back(
+        pro::make_proxy_shared_biased<DefaultFacade, SmallObject1>());
+    data.push_back(
+        pro::make_proxy_shared_biased<DefaultFacade, SmallObject2>());
+    data.push_back(
+        pro::make_proxy_shared_biased<DefaultFacade, SmallObject3>());
+  }
+  for (auto _ : state) {
+    std::vector<pro::proxy<DefaultFacade>> copy = data;
+    benchmark::DoNotOptimize(copy);
+  }
+}
+
+// The proxies are created by another thread, so that every copy of a biased
+// proxy takes the atomic path
+void BM_HotSmallObjectCopyWithProxy_SharedFromOtherThread(
+    benchmark::State& state) {
+  std::vector<pro::proxy<DefaultFacade>> data;
+  data.reserve(TestHotObjectCount);
+  std::thread([&] {
+    for (int i = 0; i < TestHotObjectCount; i += TypeSeriesCount) {
+      data.push_back(pro::make_proxy_shared<DefaultFacade, SmallObject1>());
+      data.push_back(pro::make_proxy_shared<DefaultFacade, SmallObject2>());
+      data.push_back(pro::make_proxy_shared<DefaultFacade, SmallObject3>());
+    }
+  }).join();
+  for (auto _ : state) {
+    std::vector<pro::proxy<DefaultFacade>> copy = data;
+    benchmark::DoNotOptimize(copy);
+  }
+}
+
+void BM_HotSmallObjectCopyWithProxy_SharedBiasedFromOtherThread(
+    benchmark::State& state) {
+  std::vector<pro::proxy<DefaultFacade>> data;
+  data.reserve(TestHotObjectCount);
+  std::thread([&] {
+    for (int i = 0; i < TestHotObjectCount; i += TypeSeriesCount) {
+      data.push_back(
+          pro::make_proxy_shared_biased<DefaultFacade, SmallObject1>());
+      data.push_back(
+          pro::make_proxy_shared_biased<DefaultFacade, SmallObject2>());
+      data.push_back(
+          pro::make_proxy_shared_biased<DefaultFacade, SmallObject3>());
+    }
+  }).join();
+  for (auto _ : state) {
+    std::vector<pro::proxy<DefaultFacade>> copy = data;
+    benchmark::DoNotOptimize(copy);
+  }
+}
+
+HeavyObject MakeHeavyObject() {
+  return HeavyObject(64, std::string(64, '*'));
+}
+
+// Times the release of the last reference to each proxy individually, and
+// reports the percentiles of the samples as counters
+template <class Create, class Flush>
+void MeasureReleaseLatency(benchmark::State& state, Create create,
+                           Flush flush) {
+  std::vector<pro::proxy<DefaultFacade>> data;
+  std::vector<double> samples;
+  data.reserve(TestReleasedObjectCount);
+  for (auto _ : state) {
+    state.PauseTiming();
+    for (int i = 0; i < TestReleasedObjectCount; ++i) {
+      data.push_back(create());
+    }
+    state.ResumeTiming();
+    for (auto& p : data) {
+      auto start = std::chrono::steady_clock::now();
+      p.reset();
+      auto end = std::chrono::steady_clock::now();
+      samples.push_back(
+          std::chrono::duration<double, std::nano>(end - start).count());
+    }
+    state.PauseTiming();
+    data.clear();
+    flush();
+    state.ResumeTiming();
+  }
+  std::sort(samples.begin(), samples.end());
+  auto percentile = [&](double q) {
+    return samples[static_cast<std::size_t>(q * (samples.size() - 1u))];
+  };
+  state.counters["p50_ns"] = percentile(0.5);
+  state.counters["p99_ns"] = percentile(0.99);
+  state.counters["p999_ns"] = percentile(0.999);
+}
+
+void BM_HeavyObjectReleaseWithProxy_Shared(benchmark::State& state) {
+  MeasureReleaseLatency(
+      state,
+      [] { return pro::make_proxy_shared<DefaultFacade>(MakeHeavyObject()); },
+      [] {});
+}
+
+// The blocks are reclaimed between batches, outside of the timed releases,
+// as a background reclaimer would
+void BM_HeavyObjectReleaseWithProxy_SharedDeferred(benchmark::State& state) {
+  MeasureReleaseLatency(
+      state,
+      [] {
+        return pro::make_proxy_shared_deferred<DefaultFacade>(
+            MakeHeavyObject());
+      },
+      [] { pro::reclaim(); });
+}
+
+// Times the release of the last strong reference to each proxy in a batch
+template <class F, class Create>
+void MeasureReleaseThroughput(benchmark::State& state, Create create) {
+  std::vector<pro::proxy<F>> data;
+  data.reserve(TestManagedObjectCount);
+  for (auto _ : state) {
+    state.PauseTiming();
+    for (int i = 0; i < TestManagedObjectCount; ++i) {
+      data.push_back(create());
+    }
+    state.ResumeTiming();
+    data.clear();
+  }
+}
+
+void BM_SmallObjectReleaseWithProxy_Shared(benchmark::State& state) {
+  MeasureReleaseThroughput<DefaultFacade>(state, [] {
+    return pro::make_proxy_shared<DefaultFacade, SmallObject1>();
+  });
+}
+
+void BM_SmallObjectReleaseWithProxy_SharedWeak(benchmark::State& state) {
+  MeasureReleaseThroughput<WeakFacade>(
+      state, [] { return pro::make_proxy_shared<WeakFacade, SmallObject1>(); });
+}
+
+void BM_SmallObjectReleaseWithProxy_SharedLocalWeak(benchmark::State& state) {
+  MeasureReleaseThroughput<WeakFacade>(state, [] {
+    return pro::make_proxy_shared_local<WeakFacade, SmallObject1>();
+  });
+}
+
+// A shared configuration object read by all benchmark threads
+struct SharedConfig {
+  pro::atomic_proxy<SharedFacade> Atomic =
+      pro::make_proxy_shared<SharedFacade, SmallObject1>();
+  std::mutex Mutex;
+  pro::proxy<DefaultFacade> Guarded =
+      pro::make_proxy_shared<DefaultFacade, SmallObject1>();
+  pro::rcu_cell<ViewableFacade> Rcu =
+      pro::make_proxy<ViewableFacade, SmallObject1>();
+  pro::proxy<WeakFacade> Strong =
+      pro::make_proxy_shared<WeakFacade, SmallObject1>();
+  pro::weak_proxy<WeakFacade> Weak = Strong;
+};
+SharedConfig TestSharedConfig;
+
+void BM_SharedProxyLoadWithAtomicProxy(benchmark::State& state) {
+  for (auto _ : state) {
+    pro::proxy<SharedFacade> p = TestSharedConfig.Atomic.load();
+    benchmark::DoNotOptimize(p);
+  }
+}
+
+void BM_SharedProxyReadWithRcuCell(benchmark::State& state) {
+  for (auto _ : state) {
+    TestSharedConfig.Rcu.read([](pro::proxy_view<ViewableFacade> p) {
+      benchmark::DoNotOptimize(p);
+    });
+  }
+}
+
+void BM_WeakProxyLock(benchmark::State& state) {
+  for (auto _ : state) {
+    pro::proxy<WeakFacade> p = TestSharedConfig.Weak.lock();
+    benchmark::DoNotOptimize(p);
+  }
+}
+
+void BM_WeakProxyWithLocked(benchmark::State& state) {
+  for (auto _ : state) {
+    TestSharedConfig.Weak.with_locked([](pro::proxy_view<WeakFacade> p) {
+      benchmark::DoNotOptimize(p);
+    });
+  }
+}
+
+void BM_SharedProxyLoadWithMutex(benchmark::State& state) {
+  for (auto _ : state) {
+    pro::proxy<DefaultFacade> p;
+    {
+      std::lock_guard lock{TestSharedConfig.Mutex};
+      p = TestSharedConfig.Guarded;
+    }
+    benchmark::DoNotOptimize(p);
+  }
+}
+
 void BM_SmallObjectCreationWithProxy_SharedPooled(benchmark::State& state) {
   static std::pmr::unsynchronized_pool_resource pool;
   std::pmr::polymorphic_allocator<> alloc{&pool};
@@ -175,6 +521,29 @@ void BM_LargeObjectCreationWithProxy(benchmark::State& state) {
   }
 }
 
+// LargeObject3 is not copyable
+template <class F>
+void LargeObjectCopyWithProxyImpl(benchmark::State& state) {
+  std::vector<pro::proxy<F>> data;
+  data.reserve(TestManagedObjectCount);
+  for (int i = 0; i < TestManagedObjectCount; i += 2) {
+    data.push_back(pro::make_proxy<F, LargeObject1>());
+    data.push_back(pro::make_proxy<F, LargeObject2>());
+  }
+  for (auto _ : state) {
+    std::vector<pro::proxy<F>> copy = data;
+    benchmark::DoNotOptimize(copy);
+  }
+}
+
+void BM_LargeObjectCopyWithProxy(benchmark::State& state) {
+  LargeObjectCopyWithProxyImpl<DefaultFacade>(state);
+}
+
+void BM_LargeObjectCopyWithProxy_Cow(benchmark::State& state) {
+  LargeObjectCopyWithProxyImpl<CowFacade>(state);
+}
+
 void BM_LargeObjectCreationWithProxy_Pooled(benchmark::State& state) {
   static std::pmr::unsynchronized_pool_resource pool;
   std::pmr::polymorphic_allocator<> alloc{&pool};
@@ -190,6 +559,48 @@ void BM_LargeObjectCreationWithProxy_Pooled(benchmark::State& state) {
   }
 }
 
+void BM_LargeObjectCreationWithProxy_ThreadCaching(benchmark::State& state) {
+  for (auto _ : state) {
+    std::vector<pro::proxy<ThreadCachingFacade>> data;
+    data.reserve(TestManagedObjectCount);
+    for (int i = 0; i < TestManagedObjectCount; i += TypeSeriesCount) {
+      data.push_back(pro::make_proxy<ThreadCachingFacade, LargeObject1>());
+      data.push_back(pro::make_proxy<ThreadCachingFacade, LargeObject2>());
+      data.push_back(pro::make_proxy<ThreadCachingFacade, LargeObject3>());
+    }
+    benchmark::DoNotOptimize(data);
+  }
+}
+
+void BM_LargeObjectCreationWithProxy_Monotonic(benchmark::State& state) {
+  for (auto _ : state) {
+    std::pmr::monotonic_buffer_resource resource;
+    std::pmr::polymorphic_allocator<> alloc{&resource};
+    std::vector<pro::proxy<DefaultFacade>> data;
+    data.reserve(TestManagedObjectCount);
+    for (int i = 0; i < TestManagedObjectCount; i += TypeSeriesCount) {
+      data.push_back(pro::allocate_proxy<DefaultFacade, LargeObject1>(alloc));
+      data.push_back(pro::allocate_proxy<DefaultFacade, LargeObject2>(alloc));
+      data.push_back(pro::allocate_proxy<DefaultFacade, LargeObject3>(alloc));
+    }
+    benchmark::DoNotOptimize(data);
+  }
+}
+
+void BM_LargeObjectCreationWithProxy_Arena(benchmark::State& state) {
+  for (auto _ : state) {
+    pro::proxy_arena arena;
+    std::vector<pro::proxy<DefaultFacade>> data;
+    data.reserve(TestManagedObjectCount);
+    for (int i = 0; i < TestManagedObjectCount; i += TypeSeriesCount) {
+      data.push_back(pro::make_proxy_in<DefaultFacade, LargeObject1>(arena));
+      data.push_back(pro::make_proxy_in<DefaultFacade, LargeObject2>(arena));
+      data.push_back(pro::make_proxy_in<DefaultFacade, LargeObject3>(arena));
+    }
+    benchmark::DoNotOptimize(data);
+  }
+}
+
 void BM_LargeObjectCreationWithProxy_Shared(benchmark::State& state) {
   for (auto _ : state) {
     std::vector<pro::proxy<DefaultFacade>> data;
@@ -221,6 +632,64 @@ void BM_LargeObjectCreationWithProxy_SharedPooled(benchmark::State& state) {
   }
 }
 
+void BM_LargeObjectCreationWithProxy_SharedThreadCaching(
+    benchmark::State& state) {
+  for (auto _ : state) {
+    std::vector<pro::proxy<ThreadCachingFacade>> data;
+    data.reserve(TestManagedObjectCount);
+    for (int i = 0; i < TestManagedObjectCount; i += TypeSeriesCount) {
+      data.push_back(
+          pro::make_proxy_shared<ThreadCachingFacade, LargeObject1>());
+      data.push_back(
+          pro::make_proxy_shared<ThreadCachingFacade, LargeObject2>());
+      data.push_back(
+          pro::make_proxy_shared<ThreadCachingFacade, LargeObject3>());
+    }
+    benchmark::DoNotOptimize(data);
+  }
+}
+
+void BM_MixedObjectCreationWithProxy(benchmark::State& state) {
+  for (auto _ : state) {
+    std::vector<pro::proxy<DefaultFacade>> data;
+    data.reserve(TestManagedObjectCount);
+    for (int i = 0; i < TestManagedObjectCount; i += TypeSeriesCount) {
+      data.push_back(pro::make_proxy<DefaultFacade, MixedObject1>());
+      data.push_back(pro::make_proxy<DefaultFacade, MixedObject2>());
+      data.push_back(pro::make_proxy<DefaultFacade, MixedObject3>());
+    }
+    benchmark::DoNotOptimize(data);
+  }
+}
+
+template <std::size_t Size>
+void BM_MixedObjectCreationWithProxy_SmallBuffer(benchmark::State& state) {
+  using F = SmallBufferFacade<Size>;
+  for (auto _ : state) {
+    std::vector<pro::proxy<F>> data;
+    data.reserve(TestManagedObjectCount);
+    for (int i = 0; i < TestManagedObjectCount; i += TypeSeriesCount) {
+      data.push_back(pro::make_proxy<F, MixedObject1>());
+      data.push_back(pro::make_proxy<F, MixedObject2>());
+      data.push_back(pro::make_proxy<F, MixedObject3>());
+    }
+    benchmark::DoNotOptimize(data);
+  }
+}
+
+void BM_MixedObjectCreationWithAny(benchmark::State& state) {
+  for (auto _ : state) {
+    std::vector<std::any> data;
+    data.reserve(TestManagedObjectCount);
+    for (int i = 0; i < TestManagedObjectCount; i += TypeSeriesCount) {
+      data.emplace_back(MixedObject1{});
+      data.emplace_back(MixedObject2{});
+      data.emplace_back(MixedObject3{});
+    }
+    benchmark::DoNotOptimize(data);
+  }
+}
+
 void BM_LargeObjectCreationWithUniquePtr(benchmark::State& state) {
   for (auto _ : state) {
     std::vector<std::unique_ptr<PolymorphicObjectBase>> data;
@@ -280,15 +749,50 @@ void BM_LargeObjectCreationWithAny(benchmark::State& state) {
 
 BENCHMARK(BM_SmallObjectCreationWithProxy);
 BENCHMARK(BM_SmallObjectCreationWithProxy_Shared);
+BENCHMARK(BM_SmallObjectCreationWithProxy_SharedLocal);
+BENCHMARK(BM_SmallObjectCreationWithProxy_SharedBiased);
 BENCHMARK(BM_SmallObjectCreationWithProxy_SharedPooled);
+BENCHMARK(BM_SmallObjectCopyWithProxy_Shared);
+BENCHMARK(BM_SmallObjectCopyWithProxy_SharedLocal);
+BENCHMARK(BM_SmallObjectCopyWithProxy_SharedBiased);
+BENCHMARK(BM_HotSmallObjectCopyWithProxy_Shared)->Threads(1)->Threads(4);
+BENCHMARK(BM_HotSmallObjectCopyWithProxy_SharedBiased)->Threads(1)->Threads(4);
+BENCHMARK(BM_HotSmallObjectCopyWithProxy_SharedFromOtherThread)
+    ->Threads(1)
+    ->Threads(4);
+BENCHMARK(BM_HotSmallObjectCopyWithProxy_SharedBiasedFromOtherThread)
+    ->Threads(1)
+    ->Threads(4);
+BENCHMARK(BM_HeavyObjectReleaseWithProxy_Shared);
+BENCHMARK(BM_HeavyObjectReleaseWithProxy_SharedDeferred);
+BENCHMARK(BM_SmallObjectReleaseWithProxy_Shared);
+BENCHMARK(BM_SmallObjectReleaseWithProxy_SharedWeak);
+BENCHMARK(BM_SmallObjectReleaseWithProxy_SharedLocalWeak);
+BENCHMARK(BM_SharedProxyLoadWithAtomicProxy)->ThreadRange(1, 64);
+BENCHMARK(BM_SharedProxyReadWithRcuCell)->ThreadRange(1, 64);
+BENCHMARK(BM_SharedProxyLoadWithMutex)->ThreadRange(1, 64);
+BENCHMARK(BM_WeakProxyLock)->ThreadRange(1, 64);
+BENCHMARK(BM_WeakProxyWithLocked)->ThreadRange(1, 64);
 BENCHMARK(BM_SmallObjectCreationWithUniquePtr);
 BENCHMARK(BM_SmallObjectCreationWithSharedPtr);
 BENCHMARK(BM_SmallObjectCreationWithSharedPtr_Pooled);
 BENCHMARK(BM_SmallObjectCreationWithAny);
 BENCHMARK(BM_LargeObjectCreationWithProxy);
 BENCHMARK(BM_LargeObjectCreationWithProxy_Pooled);
+BENCHMARK(BM_LargeObjectCreationWithProxy_ThreadCaching);
+BENCHMARK(BM_LargeObjectCreationWithProxy_Monotonic);
+BENCHMARK(BM_LargeObjectCreationWithProxy_Arena);
 BENCHMARK(BM_LargeObjectCreationWithProxy_Shared);
 BENCHMARK(BM_LargeObjectCreationWithProxy_SharedPooled);
+BENCHMARK(BM_LargeObjectCreationWithProxy_SharedThreadCaching);
+BENCHMARK(BM_LargeObjectCopyWithProxy);
+BENCHMARK(BM_LargeObjectCopyWithProxy_Cow);
+BENCHMARK(BM_MixedObjectCreationWithProxy);
+BENCHMARK_TEMPLATE(BM_MixedObjectCreationWithProxy_SmallBuffer, 16);
+BENCHMARK_TEMPLATE(BM_MixedObjectCreationWithProxy_SmallBuffer, 32);
+BENCHMARK_TEMPLATE(BM_MixedObjectCreationWithProxy_SmallBuffer, 64);
+BENCHMARK_TEMPLATE(BM_MixedObjectCreationWithProxy_SmallBuffer, 128);
+BENCHMARK(BM_MixedObjectCreationWithAny);
 BENCHMARK(BM_LargeObjectCreationWithUniquePtr);
 BENCHMARK(BM_LargeObjectCreationWithSharedPtr);
 BENCHMARK(BM_LargeObjectCreationWithSharedPtr_Pooled);
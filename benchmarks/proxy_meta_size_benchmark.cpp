@@ -0,0 +1,111 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+// Builds FacadeCount facades with the same conventions, each instantiated with
+// the same TypeCount types, either with skills::shared_meta or without it
+// (PROXY_BENCHMARK_SHARED_META). The sections of the two executables are
+// compared by the msft_proxy_meta_size_report target, and the benchmark
+// measures the invocations across all the metas.
+
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <proxy/proxy.h>
+
+#ifndef PROXY_BENCHMARK_SHARED_META
+#define PROXY_BENCHMARK_SHARED_META 0
+#endif // PROXY_BENCHMARK_SHARED_META
+
+namespace {
+
+constexpr std::size_t FacadeCount = 16;
+constexpr int TypeCount = 64;
+
+PRO_DEF_MEM_DISPATCH(MemFun, Fun);
+PRO_DEF_MEM_DISPATCH(MemAdd, Add);
+PRO_DEF_MEM_DISPATCH(MemScale, Scale);
+PRO_DEF_MEM_DISPATCH(MemReset, Reset);
+
+struct MetaSizeTestBaseFacade
+    : pro::facade_builder                                  //
+      ::add_convention<MemFun, int() const>                //
+      ::add_convention<MemAdd, void(int)>                  //
+      ::add_convention<MemScale, void(int)>                //
+      ::add_convention<MemReset, void()>                   //
+      ::support_copy<pro::constraint_level::nothrow>       //
+      ::support_relocation<pro::constraint_level::nothrow> //
+      ::build {};
+
+#if PROXY_BENCHMARK_SHARED_META
+template <std::size_t I>
+struct MetaSizeTestFacade : pro::facade_builder                   //
+                            ::add_facade<MetaSizeTestBaseFacade>  //
+                            ::add_skill<pro::skills::shared_meta> //
+                            ::build {};
+#else
+template <std::size_t I>
+struct MetaSizeTestFacade : pro::facade_builder                  //
+                            ::add_facade<MetaSizeTestBaseFacade> //
+                            ::build {};
+#endif // PROXY_BENCHMARK_SHARED_META
+
+template <int TypeSeries>
+class MetaSizeTestImpl {
+public:
+  explicit MetaSizeTestImpl(int seed) noexcept : value_(seed) {}
+  MetaSizeTestImpl(const MetaSizeTestImpl&) noexcept = default;
+  int Fun() const noexcept { return value_ ^ (TypeSeries + 1); }
+  void Add(int v) noexcept { value_ += v + TypeSeries; }
+  void Scale(int v) noexcept { value_ *= v + TypeSeries; }
+  void Reset() noexcept { value_ = TypeSeries; }
+
+private:
+  int value_;
+};
+
+template <std::size_t I>
+std::vector<pro::proxy<MetaSizeTestFacade<I>>> GenerateMetaSizeTestData() {
+  return []<int... TypeSeries>(std::integer_sequence<int, TypeSeries...>) {
+    std::vector<pro::proxy<MetaSizeTestFacade<I>>> result;
+    result.reserve(sizeof...(TypeSeries));
+    (result.push_back(
+         pro::make_proxy<MetaSizeTestFacade<I>, MetaSizeTestImpl<TypeSeries>>(
+             TypeSeries)),
+     ...);
+    return result;
+  }(std::make_integer_sequence<int, TypeCount>{});
+}
+
+template <std::size_t I>
+int InvokeMetaSizeTestData(std::vector<pro::proxy<MetaSizeTestFacade<I>>>& v) {
+  int result = 0;
+  for (auto& p : v) {
+    p->Add(1);
+    p->Scale(2);
+    result += p->Fun();
+    p->Reset();
+  }
+  return result;
+}
+
+void BM_MetaSizeInvocation(benchmark::State& state) {
+  [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+    auto data = std::tuple{GenerateMetaSizeTestData<Is>()...};
+    for (auto _ : state) {
+      int result = (InvokeMetaSizeTestData<Is>(std::get<Is>(data)) + ...);
+      benchmark::DoNotOptimize(result);
+    }
+  }(std::make_index_sequence<FacadeCount>{});
+}
+
+} // namespace
+
+#if PROXY_BENCHMARK_SHARED_META
+BENCHMARK(BM_MetaSizeInvocation)->Name("BM_MetaSizeInvocation_SharedMeta");
+#else
+BENCHMARK(BM_MetaSizeInvocation);
+#endif // PROXY_BENCHMARK_SHARED_META
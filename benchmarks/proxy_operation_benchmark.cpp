@@ -2,11 +2,19 @@
 // Licensed under the MIT License.
 
 #include <benchmark/benchmark.h>
+#include <memory>
+#include <span>
 
 #include "proxy_operation_benchmark_context.h"
 
 namespace {
 
+struct DoNotOptimizeOutput {
+  DoNotOptimizeOutput& operator*() noexcept { return *this; }
+  DoNotOptimizeOutput& operator++() noexcept { return *this; }
+  void operator=(int result) noexcept { benchmark::DoNotOptimize(result); }
+};
+
 void BM_SmallObjectInvocationViaProxy(benchmark::State& state) {
   auto data = GenerateSmallObjectProxyTestData();
   for (auto _ : state) {
@@ -17,6 +25,44 @@ void BM_SmallObjectInvocationViaProxy(benchmark::State& state) {
   }
 }
 
+// Invokes the last convention of a facade with `ConventionCount` conventions,
+// with the dispatchers either embedded in the proxy or stored out of line.
+template <std::size_t ConventionCount, bool InlineMeta>
+void BM_SmallObjectInvocationViaProxy_Wide(benchmark::State& state) {
+  auto data = GenerateSmallObjectProxyTestData_Wide<ConventionCount,
+                                                    InlineMeta>();
+  for (auto _ : state) {
+    for (auto& p : data) {
+      int result = p->Fun(ConventionTag<ConventionCount - 1u>{});
+      benchmark::DoNotOptimize(result);
+    }
+  }
+}
+
+template <std::size_t ConventionCount>
+void BM_SmallObjectInvocationViaProxy_HotWide(benchmark::State& state) {
+  auto data = GenerateSmallObjectProxyTestData_HotWide<ConventionCount>();
+  for (auto _ : state) {
+    for (auto& p : data) {
+      int result = p->Fun(ConventionTag<ConventionCount - 1u>{});
+      benchmark::DoNotOptimize(result);
+    }
+  }
+}
+
+// Invokes the last convention of a facade with out-of-line metas, across 1024
+// distinct types, with the metas either placed by the compiler or pooled.
+template <class F>
+void BM_SmallObjectInvocationViaProxy_ManyTypes(benchmark::State& state) {
+  auto data = GenerateSmallObjectProxyTestData_ManyTypes<F>();
+  for (auto _ : state) {
+    for (auto& p : data) {
+      int result = p->Fun(ConventionTag<5u>{});
+      benchmark::DoNotOptimize(result);
+    }
+  }
+}
+
 void BM_SmallObjectInvocationViaProxy_Shared(benchmark::State& state) {
   auto data = GenerateSmallObjectProxyTestData_Shared();
   for (auto _ : state) {
@@ -27,6 +73,57 @@ void BM_SmallObjectInvocationViaProxy_Shared(benchmark::State& state) {
   }
 }
 
+void BM_SmallObjectInvocationViaProxy_Compact(benchmark::State& state) {
+  auto data = GenerateSmallObjectProxyTestData_Compact();
+  for (auto _ : state) {
+    for (auto& p : data) {
+      int result = p->Fun();
+      benchmark::DoNotOptimize(result);
+    }
+  }
+}
+
+void BM_SmallObjectInvocationViaProxy_TypeRuns(benchmark::State& state) {
+  auto data = GenerateSmallObjectProxyTestData_TypeRuns(
+      static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    for (auto& p : data) {
+      int result = p->Fun();
+      benchmark::DoNotOptimize(result);
+    }
+  }
+}
+
+void BM_SmallObjectInvocationViaProxyBatch(benchmark::State& state) {
+  auto data = GenerateSmallObjectProxyTestData_TypeRuns(
+      static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    pro::proxy_invoke_batch<MemFun, int() const>(std::span{data},
+                                                 DoNotOptimizeOutput{});
+  }
+}
+
+void BM_SmallObjectInvocationViaProxy_Skewed(benchmark::State& state) {
+  auto data = GenerateSmallObjectProxyTestData_Skewed();
+  for (auto _ : state) {
+    for (auto& p : data) {
+      int result = p->Fun();
+      benchmark::DoNotOptimize(result);
+    }
+  }
+}
+
+void BM_SmallObjectInvocationViaProxy_SkewedSpeculative(
+    benchmark::State& state) {
+  auto data = GenerateSmallObjectProxyTestData_SkewedSpeculative();
+  for (auto _ : state) {
+    for (auto& p : data) {
+      int result = p->Fun();
+      benchmark::DoNotOptimize(result);
+    }
+  }
+}
+
 void BM_SmallObjectInvocationViaProxyView(benchmark::State& state) {
   auto data = GenerateSmallObjectProxyTestData();
   std::vector<pro::proxy_view<InvocationTestFacade>> views(data.begin(),
@@ -39,6 +136,78 @@ void BM_SmallObjectInvocationViaProxyView(benchmark::State& state) {
   }
 }
 
+void BM_SmallObjectInvocationViaGroupedProxyVector(benchmark::State& state) {
+  auto data = GenerateSmallObjectProxyTestData();
+  pro::grouped_proxy_vector<InvocationTestFacade> grouped;
+  for (auto& p : data) {
+    grouped.insert(std::move(p));
+  }
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < grouped.group_count(); ++i) {
+      for (auto& p : grouped.group(i)) {
+        int result = p->Fun();
+        benchmark::DoNotOptimize(result);
+      }
+    }
+  }
+}
+
+void BM_SmallObjectInvocationViaProxy_TriviallyRelocatable(
+    benchmark::State& state) {
+  auto data = GenerateSmallObjectProxyTestData_TriviallyRelocatable();
+  for (auto _ : state) {
+    for (auto& p : data) {
+      int result = p->Fun();
+      benchmark::DoNotOptimize(result);
+    }
+  }
+}
+
+void BM_SmallObjectInvocationViaProxySoa(benchmark::State& state) {
+  auto data = GenerateSmallObjectProxyTestData_TriviallyRelocatable();
+  pro::proxy_soa<TriviallyRelocatableInvocationTestFacade> soa;
+  soa.reserve(data.size());
+  for (auto& p : data) {
+    soa.push_back(std::move(p));
+  }
+  for (auto _ : state) {
+    for (auto&& p : soa) {
+      int result = p->Fun();
+      benchmark::DoNotOptimize(result);
+    }
+  }
+}
+
+void BM_SmallObjectTypeScanViaProxy(benchmark::State& state) {
+  using Soa = pro::proxy_soa<TriviallyRelocatableInvocationTestFacade>;
+  auto data = GenerateSmallObjectProxyTestData_TriviallyRelocatable();
+  auto type = Soa::type_of(data.front());
+  for (auto _ : state) {
+    std::size_t count = 0u;
+    for (auto& p : data) {
+      count += Soa::type_of(p) == type;
+    }
+    benchmark::DoNotOptimize(count);
+  }
+}
+
+void BM_SmallObjectTypeScanViaProxySoa(benchmark::State& state) {
+  auto data = GenerateSmallObjectProxyTestData_TriviallyRelocatable();
+  pro::proxy_soa<TriviallyRelocatableInvocationTestFacade> soa;
+  soa.reserve(data.size());
+  for (auto& p : data) {
+    soa.push_back(std::move(p));
+  }
+  auto type = soa.type_at(0);
+  for (auto _ : state) {
+    std::size_t count = 0u;
+    for (std::size_t i = 0; i < soa.size(); ++i) {
+      count += soa.type_at(i) == type;
+    }
+    benchmark::DoNotOptimize(count);
+  }
+}
+
 void BM_SmallObjectInvocationViaVirtualFunction(benchmark::State& state) {
   auto data = GenerateSmallObjectVirtualFunctionTestData();
   for (auto _ : state) {
@@ -60,6 +229,17 @@ void BM_SmallObjectInvocationViaVirtualFunction_Shared(
   }
 }
 
+void BM_SmallObjectInvocationViaVirtualFunction_Skewed(
+    benchmark::State& state) {
+  auto data = GenerateSmallObjectVirtualFunctionTestData_Skewed();
+  for (auto _ : state) {
+    for (auto& p : data) {
+      int result = p->Fun();
+      benchmark::DoNotOptimize(result);
+    }
+  }
+}
+
 void BM_SmallObjectInvocationViaVirtualFunction_RawPtr(
     benchmark::State& state) {
   auto data = GenerateSmallObjectVirtualFunctionTestData();
@@ -96,6 +276,64 @@ void BM_LargeObjectInvocationViaProxy_Shared(benchmark::State& state) {
   }
 }
 
+void BM_LargeObjectInvocationViaProxy_Compact(benchmark::State& state) {
+  pro::compact_arena arena{pro::compact_arena::max_capacity};
+  auto data = GenerateLargeObjectProxyTestData_Compact(arena);
+  for (auto _ : state) {
+    for (auto& p : data) {
+      int result = p->Fun();
+      benchmark::DoNotOptimize(result);
+    }
+  }
+}
+
+void BM_LargeObjectInvocationViaProxy_FewTypes(benchmark::State& state) {
+  auto data = GenerateLargeObjectProxyTestData_FewTypes();
+  for (auto _ : state) {
+    for (auto& p : data) {
+      int result = p->Fun();
+      benchmark::DoNotOptimize(result);
+    }
+  }
+}
+
+void BM_LargeObjectInvocationViaProxy_Tagged(benchmark::State& state) {
+  auto data = GenerateLargeObjectProxyTestData_Tagged();
+  for (auto _ : state) {
+    for (auto& p : data) {
+      int result = p->Fun();
+      benchmark::DoNotOptimize(result);
+    }
+  }
+}
+
+// Invokes raw pointers, which skills::register_dispatch passes to the
+// dispatchers in a register.
+template <class F>
+void BM_LargeObjectInvocationViaProxy_RawPtr(benchmark::State& state) {
+  std::vector<std::shared_ptr<void>> objects;
+  auto data = GenerateLargeObjectProxyTestData_RawPtr<F>(objects);
+  for (auto _ : state) {
+    for (auto& p : data) {
+      int result = p->Fun();
+      benchmark::DoNotOptimize(result);
+    }
+  }
+}
+
+template <class F>
+void BM_LargeObjectInvocationViaProxyView_RawPtr(benchmark::State& state) {
+  std::vector<std::shared_ptr<void>> objects;
+  auto data = GenerateLargeObjectProxyTestData_RawPtr<F>(objects);
+  std::vector<pro::proxy_view<F>> views(data.begin(), data.end());
+  for (auto _ : state) {
+    for (auto& p : views) {
+      int result = p->Fun();
+      benchmark::DoNotOptimize(result);
+    }
+  }
+}
+
 void BM_LargeObjectInvocationViaProxyView(benchmark::State& state) {
   auto data = GenerateLargeObjectProxyTestData();
   std::vector<pro::proxy_view<InvocationTestFacade>> views(data.begin(),
@@ -108,6 +346,22 @@ void BM_LargeObjectInvocationViaProxyView(benchmark::State& state) {
   }
 }
 
+void BM_LargeObjectInvocationViaGroupedProxyVector(benchmark::State& state) {
+  auto data = GenerateLargeObjectProxyTestData();
+  pro::grouped_proxy_vector<InvocationTestFacade> grouped;
+  for (auto& p : data) {
+    grouped.insert(std::move(p));
+  }
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < grouped.group_count(); ++i) {
+      for (auto& p : grouped.group(i)) {
+        int result = p->Fun();
+        benchmark::DoNotOptimize(result);
+      }
+    }
+  }
+}
+
 void BM_LargeObjectInvocationViaVirtualFunction(benchmark::State& state) {
   auto data = GenerateLargeObjectVirtualFunctionTestData();
   for (auto _ : state) {
@@ -170,6 +424,84 @@ void BM_SmallObjectRelocationViaProxy_NothrowRelocatable(
   }
 }
 
+// Relocates all the elements back and forth between two uninitialized buffers
+// with pro::uninitialized_relocate_n.
+template <class F>
+void RelocateInBulk(benchmark::State& state, std::vector<pro::proxy<F>> data) {
+  std::size_t count = data.size();
+  std::allocator<pro::proxy<F>> alloc;
+  pro::proxy<F>* src = alloc.allocate(count);
+  pro::proxy<F>* dst = alloc.allocate(count);
+  std::uninitialized_move_n(data.begin(), count, src);
+  for (auto _ : state) {
+    pro::uninitialized_relocate_n(src, count, dst);
+    benchmark::DoNotOptimize(dst);
+    std::swap(src, dst);
+  }
+  pro::destroy_n(src, count);
+  alloc.deallocate(src, count);
+  alloc.deallocate(dst, count);
+}
+
+void BM_SmallObjectRelocationViaProxy_Bulk(benchmark::State& state) {
+  RelocateInBulk(state, GenerateSmallObjectProxyTestData());
+}
+
+void BM_SmallObjectRelocationViaProxy_BulkTypeRuns(benchmark::State& state) {
+  RelocateInBulk(state, GenerateSmallObjectProxyTestData_TypeRuns(
+                            static_cast<int>(state.range(0))));
+}
+
+void BM_SmallObjectRelocationViaProxy_BulkTriviallyRelocatable(
+    benchmark::State& state) {
+  RelocateInBulk(state,
+                 GenerateSmallObjectProxyTestData_TriviallyRelocatable());
+}
+
+// Copy-assigns every element of `data` to the element of a copy of `data` at
+// the same index, which contains a value of the same type.
+template <class F>
+void CopyAssignInBulk(benchmark::State& state,
+                      std::vector<pro::proxy<F>> data) {
+  auto buffer = data;
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < data.size(); ++i) {
+      buffer[i] = data[i];
+    }
+    benchmark::DoNotOptimize(buffer);
+  }
+}
+
+// Swaps every element of `data` with the element of a copy of `data` at the
+// same index, which contains a value of the same type.
+template <class F>
+void SwapInBulk(benchmark::State& state, std::vector<pro::proxy<F>> data) {
+  auto buffer = data;
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < data.size(); ++i) {
+      swap(buffer[i], data[i]);
+    }
+    benchmark::DoNotOptimize(buffer);
+  }
+}
+
+void BM_SmallObjectCopyAssignmentViaProxy(benchmark::State& state) {
+  CopyAssignInBulk(state, GenerateSmallObjectProxyTestData_Copyable());
+}
+
+void BM_SmallObjectCopyAssignmentViaProxy_InPlace(benchmark::State& state) {
+  CopyAssignInBulk(state,
+                   GenerateSmallObjectProxyTestData_InPlaceAssignable());
+}
+
+void BM_SmallObjectSwapViaProxy(benchmark::State& state) {
+  SwapInBulk(state, GenerateSmallObjectProxyTestData_Copyable());
+}
+
+void BM_SmallObjectSwapViaProxy_InPlace(benchmark::State& state) {
+  SwapInBulk(state, GenerateSmallObjectProxyTestData_InPlaceAssignable());
+}
+
 void BM_SmallObjectRelocationViaUniquePtr(benchmark::State& state) {
   auto data = GenerateSmallObjectVirtualFunctionTestData();
   decltype(data) buffer(data.size());
@@ -219,6 +551,27 @@ void BM_LargeObjectRelocationViaProxy_NothrowRelocatable(
   }
 }
 
+void BM_LargeObjectRelocationViaProxy_Bulk(benchmark::State& state) {
+  RelocateInBulk(state, GenerateLargeObjectProxyTestData());
+}
+
+void BM_LargeObjectCopyAssignmentViaProxy(benchmark::State& state) {
+  CopyAssignInBulk(state, GenerateLargeObjectProxyTestData_Copyable());
+}
+
+void BM_LargeObjectCopyAssignmentViaProxy_InPlace(benchmark::State& state) {
+  CopyAssignInBulk(state,
+                   GenerateLargeObjectProxyTestData_InPlaceAssignable());
+}
+
+void BM_LargeObjectSwapViaProxy(benchmark::State& state) {
+  SwapInBulk(state, GenerateLargeObjectProxyTestData_Copyable());
+}
+
+void BM_LargeObjectSwapViaProxy_InPlace(benchmark::State& state) {
+  SwapInBulk(state, GenerateLargeObjectProxyTestData_InPlaceAssignable());
+}
+
 void BM_LargeObjectRelocationViaUniquePtr(benchmark::State& state) {
   auto data = GenerateLargeObjectVirtualFunctionTestData();
   decltype(data) buffer(data.size());
@@ -245,22 +598,77 @@ void BM_LargeObjectRelocationViaAny(benchmark::State& state) {
 
 BENCHMARK(BM_SmallObjectInvocationViaProxy);
 BENCHMARK(BM_SmallObjectInvocationViaProxy_Shared);
+BENCHMARK(BM_SmallObjectInvocationViaProxy_Compact);
+BENCHMARK(BM_SmallObjectInvocationViaProxy_TypeRuns)
+    ->RangeMultiplier(4)
+    ->Range(1, 256);
+BENCHMARK(BM_SmallObjectInvocationViaProxyBatch)
+    ->RangeMultiplier(4)
+    ->Range(1, 256);
+BENCHMARK_TEMPLATE(BM_SmallObjectInvocationViaProxy_Wide, 2, false);
+BENCHMARK_TEMPLATE(BM_SmallObjectInvocationViaProxy_Wide, 2, true);
+BENCHMARK_TEMPLATE(BM_SmallObjectInvocationViaProxy_Wide, 4, false);
+BENCHMARK_TEMPLATE(BM_SmallObjectInvocationViaProxy_Wide, 4, true);
+BENCHMARK_TEMPLATE(BM_SmallObjectInvocationViaProxy_Wide, 6, false);
+BENCHMARK_TEMPLATE(BM_SmallObjectInvocationViaProxy_Wide, 6, true);
+BENCHMARK_TEMPLATE(BM_SmallObjectInvocationViaProxy_Wide, 8, false);
+BENCHMARK_TEMPLATE(BM_SmallObjectInvocationViaProxy_Wide, 8, true);
+BENCHMARK_TEMPLATE(BM_SmallObjectInvocationViaProxy_HotWide, 4);
+BENCHMARK_TEMPLATE(BM_SmallObjectInvocationViaProxy_HotWide, 8);
+BENCHMARK_TEMPLATE(BM_SmallObjectInvocationViaProxy_ManyTypes,
+                   WideInvocationTestFacade<6, false>);
+BENCHMARK_TEMPLATE(BM_SmallObjectInvocationViaProxy_ManyTypes,
+                   PooledWideInvocationTestFacade<6>);
+BENCHMARK(BM_SmallObjectInvocationViaProxy_Skewed);
+BENCHMARK(BM_SmallObjectInvocationViaProxy_SkewedSpeculative);
 BENCHMARK(BM_SmallObjectInvocationViaProxyView);
+BENCHMARK(BM_SmallObjectInvocationViaGroupedProxyVector);
+BENCHMARK(BM_SmallObjectInvocationViaProxy_TriviallyRelocatable);
+BENCHMARK(BM_SmallObjectInvocationViaProxySoa);
+BENCHMARK(BM_SmallObjectTypeScanViaProxy);
+BENCHMARK(BM_SmallObjectTypeScanViaProxySoa);
 BENCHMARK(BM_SmallObjectInvocationViaVirtualFunction);
 BENCHMARK(BM_SmallObjectInvocationViaVirtualFunction_Shared);
+BENCHMARK(BM_SmallObjectInvocationViaVirtualFunction_Skewed);
 BENCHMARK(BM_SmallObjectInvocationViaVirtualFunction_RawPtr);
 BENCHMARK(BM_LargeObjectInvocationViaProxy);
 BENCHMARK(BM_LargeObjectInvocationViaProxy_Shared);
+BENCHMARK(BM_LargeObjectInvocationViaProxy_Compact);
+BENCHMARK(BM_LargeObjectInvocationViaProxy_FewTypes);
+BENCHMARK(BM_LargeObjectInvocationViaProxy_Tagged);
 BENCHMARK(BM_LargeObjectInvocationViaProxyView);
+BENCHMARK_TEMPLATE(BM_LargeObjectInvocationViaProxy_RawPtr,
+                   InvocationTestFacade);
+BENCHMARK_TEMPLATE(BM_LargeObjectInvocationViaProxy_RawPtr,
+                   RegisterInvocationTestFacade);
+BENCHMARK_TEMPLATE(BM_LargeObjectInvocationViaProxyView_RawPtr,
+                   InvocationTestFacade);
+BENCHMARK_TEMPLATE(BM_LargeObjectInvocationViaProxyView_RawPtr,
+                   RegisterInvocationTestFacade);
+BENCHMARK(BM_LargeObjectInvocationViaGroupedProxyVector);
 BENCHMARK(BM_LargeObjectInvocationViaVirtualFunction);
 BENCHMARK(BM_LargeObjectInvocationViaVirtualFunction_Shared);
 BENCHMARK(BM_LargeObjectInvocationViaVirtualFunction_RawPtr);
 BENCHMARK(BM_SmallObjectRelocationViaProxy);
 BENCHMARK(BM_SmallObjectRelocationViaProxy_NothrowRelocatable);
+BENCHMARK(BM_SmallObjectRelocationViaProxy_Bulk);
+BENCHMARK(BM_SmallObjectRelocationViaProxy_BulkTypeRuns)
+    ->RangeMultiplier(4)
+    ->Range(1, 256);
+BENCHMARK(BM_SmallObjectRelocationViaProxy_BulkTriviallyRelocatable);
+BENCHMARK(BM_SmallObjectCopyAssignmentViaProxy);
+BENCHMARK(BM_SmallObjectCopyAssignmentViaProxy_InPlace);
+BENCHMARK(BM_SmallObjectSwapViaProxy);
+BENCHMARK(BM_SmallObjectSwapViaProxy_InPlace);
 BENCHMARK(BM_SmallObjectRelocationViaUniquePtr);
 BENCHMARK(BM_SmallObjectRelocationViaAny);
 BENCHMARK(BM_LargeObjectRelocationViaProxy);
 BENCHMARK(BM_LargeObjectRelocationViaProxy_NothrowRelocatable);
+BENCHMARK(BM_LargeObjectRelocationViaProxy_Bulk);
+BENCHMARK(BM_LargeObjectCopyAssignmentViaProxy);
+BENCHMARK(BM_LargeObjectCopyAssignmentViaProxy_InPlace);
+BENCHMARK(BM_LargeObjectSwapViaProxy);
+BENCHMARK(BM_LargeObjectSwapViaProxy_InPlace);
 BENCHMARK(BM_LargeObjectRelocationViaUniquePtr);
 BENCHMARK(BM_LargeObjectRelocationViaAny);
 
@@ -7,17 +7,8 @@ namespace {
 
 constexpr int TestDataSize = 1000000;
 constexpr int TypeSeriesCount = 100;
-
-template <int TypeSeries>
-class NonIntrusiveSmallImpl {
-public:
-  explicit NonIntrusiveSmallImpl(int seed) noexcept : seed_(seed) {}
-  NonIntrusiveSmallImpl(const NonIntrusiveSmallImpl&) noexcept = default;
-  int Fun() const noexcept { return seed_ ^ (TypeSeries + 1); }
-
-private:
-  int seed_;
-};
+// The number of types a tagged facade can tell apart
+constexpr int TaggedTypeSeriesCount = 7;
 
 template <int TypeSeries>
 class NonIntrusiveLargeImpl {
@@ -54,23 +45,54 @@ private:
   int seed_;
 };
 
+constexpr int ManyTypeSeriesCount = 1024;
+
 template <int V>
 struct IntConstant {};
 
+// Consecutive elements share the same type series in runs of `run_length`.
+template <int FromTypeSeries, class T, class F>
+void FillTestData(std::vector<T>& data, const F& generator, int run_length) {
+  if constexpr (FromTypeSeries < TypeSeriesCount) {
+    for (int i = FromTypeSeries * run_length; i < TestDataSize;
+         i += TypeSeriesCount * run_length) {
+      for (int j = i; j < i + run_length && j < TestDataSize; ++j) {
+        data[j] = generator(IntConstant<FromTypeSeries>{}, j);
+      }
+    }
+    FillTestData<FromTypeSeries + 1>(data, generator, run_length);
+  }
+}
+
+template <class F>
+auto GenerateTestData(const F& generator, int run_length = 1) {
+  std::vector<decltype(generator(IntConstant<0>{}, 0))> result(TestDataSize);
+  FillTestData<0>(result, generator, run_length);
+  return result;
+}
+
+// About 96% of the elements alternate between type series 0 and 1, and the
+// rest are spread across the other type series.
+int GetSkewedTypeSeries(int index) {
+  return index % 25 == 0 ? 2 + index / 25 % (TypeSeriesCount - 2) : index % 2;
+}
+
 template <int FromTypeSeries, class T, class F>
-void FillTestData(std::vector<T>& data, const F& generator) {
+void FillSkewedTestData(std::vector<T>& data, const F& generator) {
   if constexpr (FromTypeSeries < TypeSeriesCount) {
-    for (int i = FromTypeSeries; i < TestDataSize; i += TypeSeriesCount) {
-      data[i] = generator(IntConstant<FromTypeSeries>{}, i);
+    for (int i = 0; i < TestDataSize; ++i) {
+      if (GetSkewedTypeSeries(i) == FromTypeSeries) {
+        data[i] = generator(IntConstant<FromTypeSeries>{}, i);
+      }
     }
-    FillTestData<FromTypeSeries + 1>(data, generator);
+    FillSkewedTestData<FromTypeSeries + 1>(data, generator);
   }
 }
 
 template <class F>
-auto GenerateTestData(const F& generator) {
+auto GenerateSkewedTestData(const F& generator) {
   std::vector<decltype(generator(IntConstant<0>{}, 0))> result(TestDataSize);
-  FillTestData<0>(result, generator);
+  FillSkewedTestData<0>(result, generator);
   return result;
 }
 
@@ -84,6 +106,15 @@ std::vector<pro::proxy<InvocationTestFacade>>
                                NonIntrusiveSmallImpl<TypeSeries>>(seed);
       });
 }
+std::vector<pro::proxy<InvocationTestFacade>>
+    GenerateSmallObjectProxyTestData_TypeRuns(int run_length) {
+  return GenerateTestData(
+      []<int TypeSeries>(IntConstant<TypeSeries>, int seed) {
+        return pro::make_proxy<InvocationTestFacade,
+                               NonIntrusiveSmallImpl<TypeSeries>>(seed);
+      },
+      run_length);
+}
 std::vector<pro::proxy<NothrowRelocatableInvocationTestFacade>>
     GenerateSmallObjectProxyTestData_NothrowRelocatable() {
   return GenerateTestData(
@@ -92,6 +123,96 @@ std::vector<pro::proxy<NothrowRelocatableInvocationTestFacade>>
                                NonIntrusiveSmallImpl<TypeSeries>>(seed);
       });
 }
+std::vector<pro::proxy<TriviallyRelocatableInvocationTestFacade>>
+    GenerateSmallObjectProxyTestData_TriviallyRelocatable() {
+  return GenerateTestData(
+      []<int TypeSeries>(IntConstant<TypeSeries>, int seed) {
+        return pro::make_proxy<TriviallyRelocatableInvocationTestFacade,
+                               NonIntrusiveSmallImpl<TypeSeries>>(seed);
+      });
+}
+std::vector<pro::proxy<CopyableInvocationTestFacade>>
+    GenerateSmallObjectProxyTestData_Copyable() {
+  return GenerateTestData(
+      []<int TypeSeries>(IntConstant<TypeSeries>, int seed) {
+        return pro::make_proxy<CopyableInvocationTestFacade,
+                               NonIntrusiveSmallImpl<TypeSeries>>(seed);
+      });
+}
+std::vector<pro::proxy<InPlaceAssignableInvocationTestFacade>>
+    GenerateSmallObjectProxyTestData_InPlaceAssignable() {
+  return GenerateTestData(
+      []<int TypeSeries>(IntConstant<TypeSeries>, int seed) {
+        return pro::make_proxy<InPlaceAssignableInvocationTestFacade,
+                               NonIntrusiveSmallImpl<TypeSeries>>(seed);
+      });
+}
+template <std::size_t ConventionCount, bool InlineMeta>
+std::vector<pro::proxy<WideInvocationTestFacade<ConventionCount, InlineMeta>>>
+    GenerateSmallObjectProxyTestData_Wide() {
+  return GenerateTestData(
+      []<int TypeSeries>(IntConstant<TypeSeries>, int seed) {
+        return pro::make_proxy<
+            WideInvocationTestFacade<ConventionCount, InlineMeta>,
+            NonIntrusiveWideImpl<TypeSeries>>(seed);
+      });
+}
+template std::vector<pro::proxy<WideInvocationTestFacade<2, false>>>
+    GenerateSmallObjectProxyTestData_Wide<2, false>();
+template std::vector<pro::proxy<WideInvocationTestFacade<2, true>>>
+    GenerateSmallObjectProxyTestData_Wide<2, true>();
+template std::vector<pro::proxy<WideInvocationTestFacade<4, false>>>
+    GenerateSmallObjectProxyTestData_Wide<4, false>();
+template std::vector<pro::proxy<WideInvocationTestFacade<4, true>>>
+    GenerateSmallObjectProxyTestData_Wide<4, true>();
+template std::vector<pro::proxy<WideInvocationTestFacade<6, false>>>
+    GenerateSmallObjectProxyTestData_Wide<6, false>();
+template std::vector<pro::proxy<WideInvocationTestFacade<6, true>>>
+    GenerateSmallObjectProxyTestData_Wide<6, true>();
+template std::vector<pro::proxy<WideInvocationTestFacade<8, false>>>
+    GenerateSmallObjectProxyTestData_Wide<8, false>();
+template std::vector<pro::proxy<WideInvocationTestFacade<8, true>>>
+    GenerateSmallObjectProxyTestData_Wide<8, true>();
+template <std::size_t ConventionCount>
+std::vector<pro::proxy<HotWideInvocationTestFacade<ConventionCount>>>
+    GenerateSmallObjectProxyTestData_HotWide() {
+  return GenerateTestData(
+      []<int TypeSeries>(IntConstant<TypeSeries>, int seed) {
+        return pro::make_proxy<HotWideInvocationTestFacade<ConventionCount>,
+                               NonIntrusiveWideImpl<TypeSeries>>(seed);
+      });
+}
+template std::vector<pro::proxy<HotWideInvocationTestFacade<4>>>
+    GenerateSmallObjectProxyTestData_HotWide<4>();
+template std::vector<pro::proxy<HotWideInvocationTestFacade<8>>>
+    GenerateSmallObjectProxyTestData_HotWide<8>();
+
+template <class F>
+std::vector<pro::proxy<F>> GenerateSmallObjectProxyTestData_ManyTypes() {
+  using Factory = pro::proxy<F> (*)(int);
+  static constexpr auto factories =
+      []<int... TypeSeries>(std::integer_sequence<int, TypeSeries...>) {
+        return std::array<Factory, sizeof...(TypeSeries)>{
+            [](int seed) -> pro::proxy<F> {
+              return pro::make_proxy<F, NonIntrusiveWideImpl<TypeSeries>>(
+                  seed);
+            }...};
+      }(std::make_integer_sequence<int, ManyTypeSeriesCount>{});
+  std::vector<pro::proxy<F>> result;
+  result.reserve(TestDataSize);
+  for (int i = 0; i < TestDataSize; ++i) {
+    // Scatters the type series with a multiplicative hash of the index
+    auto type_series = static_cast<unsigned>(i) * 2654435761u %
+                       static_cast<unsigned>(ManyTypeSeriesCount);
+    result.push_back(factories[type_series](i));
+  }
+  return result;
+}
+template std::vector<pro::proxy<WideInvocationTestFacade<6, false>>>
+    GenerateSmallObjectProxyTestData_ManyTypes();
+template std::vector<pro::proxy<PooledWideInvocationTestFacade<6>>>
+    GenerateSmallObjectProxyTestData_ManyTypes();
+
 std::vector<pro::proxy<InvocationTestFacade>>
     GenerateSmallObjectProxyTestData_Shared() {
   return GenerateTestData(
@@ -100,6 +221,30 @@ std::vector<pro::proxy<InvocationTestFacade>>
                                       NonIntrusiveSmallImpl<TypeSeries>>(seed);
       });
 }
+std::vector<pro::proxy<CompactInvocationTestFacade>>
+    GenerateSmallObjectProxyTestData_Compact() {
+  return GenerateTestData(
+      []<int TypeSeries>(IntConstant<TypeSeries>, int seed) {
+        return pro::make_proxy<CompactInvocationTestFacade,
+                               NonIntrusiveSmallImpl<TypeSeries>>(seed);
+      });
+}
+std::vector<pro::proxy<InvocationTestFacade>>
+    GenerateSmallObjectProxyTestData_Skewed() {
+  return GenerateSkewedTestData(
+      []<int TypeSeries>(IntConstant<TypeSeries>, int seed) {
+        return pro::make_proxy<InvocationTestFacade,
+                               NonIntrusiveSmallImpl<TypeSeries>>(seed);
+      });
+}
+std::vector<pro::proxy<SpeculativeInvocationTestFacade>>
+    GenerateSmallObjectProxyTestData_SkewedSpeculative() {
+  return GenerateSkewedTestData(
+      []<int TypeSeries>(IntConstant<TypeSeries>, int seed) {
+        return pro::make_proxy<SpeculativeInvocationTestFacade,
+                               NonIntrusiveSmallImpl<TypeSeries>>(seed);
+      });
+}
 std::vector<std::unique_ptr<InvocationTestBase>>
     GenerateSmallObjectVirtualFunctionTestData() {
   return GenerateTestData(
@@ -108,6 +253,14 @@ std::vector<std::unique_ptr<InvocationTestBase>>
             new IntrusiveSmallImpl<TypeSeries>(seed)};
       });
 }
+std::vector<std::unique_ptr<InvocationTestBase>>
+    GenerateSmallObjectVirtualFunctionTestData_Skewed() {
+  return GenerateSkewedTestData(
+      []<int TypeSeries>(IntConstant<TypeSeries>, int seed) {
+        return std::unique_ptr<InvocationTestBase>{
+            new IntrusiveSmallImpl<TypeSeries>(seed)};
+      });
+}
 std::vector<std::shared_ptr<InvocationTestBase>>
     GenerateSmallObjectVirtualFunctionTestData_Shared() {
   return GenerateTestData(
@@ -139,6 +292,22 @@ std::vector<pro::proxy<NothrowRelocatableInvocationTestFacade>>
                                NonIntrusiveLargeImpl<TypeSeries>>(seed);
       });
 }
+std::vector<pro::proxy<CopyableInvocationTestFacade>>
+    GenerateLargeObjectProxyTestData_Copyable() {
+  return GenerateTestData(
+      []<int TypeSeries>(IntConstant<TypeSeries>, int seed) {
+        return pro::make_proxy<CopyableInvocationTestFacade,
+                               NonIntrusiveLargeImpl<TypeSeries>>(seed);
+      });
+}
+std::vector<pro::proxy<InPlaceAssignableInvocationTestFacade>>
+    GenerateLargeObjectProxyTestData_InPlaceAssignable() {
+  return GenerateTestData(
+      []<int TypeSeries>(IntConstant<TypeSeries>, int seed) {
+        return pro::make_proxy<InPlaceAssignableInvocationTestFacade,
+                               NonIntrusiveLargeImpl<TypeSeries>>(seed);
+      });
+}
 std::vector<pro::proxy<InvocationTestFacade>>
     GenerateLargeObjectProxyTestData_Shared() {
   return GenerateTestData(
@@ -147,6 +316,50 @@ std::vector<pro::proxy<InvocationTestFacade>>
                                       NonIntrusiveLargeImpl<TypeSeries>>(seed);
       });
 }
+std::vector<pro::proxy<CompactInvocationTestFacade>>
+    GenerateLargeObjectProxyTestData_Compact(pro::compact_arena& arena) {
+  return GenerateTestData(
+      [&]<int TypeSeries>(IntConstant<TypeSeries>, int seed) {
+        return pro::make_proxy_in<CompactInvocationTestFacade,
+                                  NonIntrusiveLargeImpl<TypeSeries>>(arena,
+                                                                     seed);
+      });
+}
+std::vector<pro::proxy<InvocationTestFacade>>
+    GenerateLargeObjectProxyTestData_FewTypes() {
+  return GenerateTestData(
+      []<int TypeSeries>(IntConstant<TypeSeries>, int seed) {
+        return pro::make_proxy<
+            InvocationTestFacade,
+            NonIntrusiveLargeImpl<TypeSeries % TaggedTypeSeriesCount>>(seed);
+      });
+}
+std::vector<pro::proxy<TaggedInvocationTestFacade>>
+    GenerateLargeObjectProxyTestData_Tagged() {
+  return GenerateTestData(
+      []<int TypeSeries>(IntConstant<TypeSeries>, int seed) {
+        return pro::make_proxy<
+            TaggedInvocationTestFacade,
+            NonIntrusiveLargeImpl<TypeSeries % TaggedTypeSeriesCount>>(seed);
+      });
+}
+template <class F>
+std::vector<pro::proxy<F>> GenerateLargeObjectProxyTestData_RawPtr(
+    std::vector<std::shared_ptr<void>>& objects) {
+  objects.reserve(TestDataSize);
+  return GenerateTestData(
+      [&]<int TypeSeries>(IntConstant<TypeSeries>, int seed) {
+        auto object = std::make_shared<NonIntrusiveLargeImpl<TypeSeries>>(seed);
+        objects.push_back(object);
+        return pro::proxy<F>{object.get()};
+      });
+}
+template std::vector<pro::proxy<InvocationTestFacade>>
+    GenerateLargeObjectProxyTestData_RawPtr<InvocationTestFacade>(
+        std::vector<std::shared_ptr<void>>& objects);
+template std::vector<pro::proxy<RegisterInvocationTestFacade>>
+    GenerateLargeObjectProxyTestData_RawPtr<RegisterInvocationTestFacade>(
+        std::vector<std::shared_ptr<void>>& objects);
 std::vector<std::unique_ptr<InvocationTestBase>>
     GenerateLargeObjectVirtualFunctionTestData() {
   return GenerateTestData(
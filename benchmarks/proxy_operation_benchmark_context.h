@@ -2,7 +2,11 @@
 // Licensed under the MIT License.
 
 #include <any>
+#include <array>
+#include <cstddef>
 #include <memory>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <proxy/proxy.h>
@@ -15,10 +19,124 @@ struct InvocationTestFacade : pro::facade_builder                   //
                               ::add_skill<pro::skills::slim>        //
                               ::build {};
 
+template <int TypeSeries>
+class NonIntrusiveSmallImpl {
+public:
+  explicit NonIntrusiveSmallImpl(int seed) noexcept : seed_(seed) {}
+  NonIntrusiveSmallImpl(const NonIntrusiveSmallImpl&) noexcept = default;
+  int Fun() const noexcept { return seed_ ^ (TypeSeries + 1); }
+
+private:
+  int seed_;
+};
+
+struct SpeculativeInvocationTestFacade
+    : pro::facade_builder                                           //
+      ::add_facade<InvocationTestFacade>                            //
+      ::add_skill<pro::skills::speculate, NonIntrusiveSmallImpl<0>, //
+                  NonIntrusiveSmallImpl<1>>                         //
+      ::build {};
+
+// A facade whose proxies are 8 bytes: a 4-byte meta index and a 4-byte
+// payload that is either the object itself or a handle into a compact_arena.
+struct CompactInvocationTestFacade
+    : pro::facade_builder                   //
+      ::add_convention<MemFun, int() const> //
+      ::add_skill<pro::skills::compact>     //
+      ::build {};
+
+// A facade whose proxies are a single word: the address of the object with
+// the index of its type packed into the low bits.
+struct TaggedInvocationTestFacade
+    : pro::facade_builder                   //
+      ::add_convention<MemFun, int() const> //
+      ::add_skill<pro::skills::tagged>      //
+      ::build {};
+
+// A facade whose dispatchers receive the contained pointer in a register
+// instead of a reference to the proxy.
+struct RegisterInvocationTestFacade
+    : pro::facade_builder                         //
+      ::add_facade<InvocationTestFacade>          //
+      ::add_skill<pro::skills::register_dispatch> //
+      ::build {};
+
+template <std::size_t I>
+using ConventionTag = std::integral_constant<std::size_t, I>;
+
+template <class Is, bool InlineMeta>
+struct WideInvocationTestFacadeTraits;
+template <std::size_t... Is, bool InlineMeta>
+struct WideInvocationTestFacadeTraits<std::index_sequence<Is...>, InlineMeta> {
+  using builder = typename pro::facade_builder                            //
+      ::add_convention<MemFun, int(ConventionTag<Is>) const noexcept...> //
+      ::template add_skill<pro::skills::slim>;
+  using type = typename std::conditional_t<
+      InlineMeta,
+      typename builder::template inline_meta<sizeof...(Is) + 1u>, // + destroy
+      builder>::build;
+};
+
+// A facade with `ConventionCount` dispatchers. When `InlineMeta` is true, all
+// of them are embedded in the proxy.
+template <std::size_t ConventionCount, bool InlineMeta>
+struct WideInvocationTestFacade
+    : WideInvocationTestFacadeTraits<std::make_index_sequence<ConventionCount>,
+                                     InlineMeta>::type {};
+
+// The same facade with only the last convention stored in the proxy.
+template <std::size_t ConventionCount>
+struct HotWideInvocationTestFacade
+    : pro::facade_builder                                           //
+      ::add_facade<WideInvocationTestFacade<ConventionCount, false>> //
+      ::add_hot_convention<MemFun, int(ConventionTag<ConventionCount - 1u>)
+                                       const noexcept> //
+      ::build {};
+
+// The same facade with its out-of-line metas pooled by skills::pooled_meta.
+template <std::size_t ConventionCount>
+struct PooledWideInvocationTestFacade
+    : pro::facade_builder                                           //
+      ::add_facade<WideInvocationTestFacade<ConventionCount, false>> //
+      ::add_skill<pro::skills::pooled_meta>                          //
+      ::build {};
+
+template <int TypeSeries>
+class NonIntrusiveWideImpl {
+public:
+  explicit NonIntrusiveWideImpl(int seed) noexcept : seed_(seed) {}
+  NonIntrusiveWideImpl(const NonIntrusiveWideImpl&) noexcept = default;
+  template <std::size_t I>
+  int Fun(ConventionTag<I>) const noexcept {
+    return seed_ ^ (TypeSeries + static_cast<int>(I) + 1);
+  }
+
+private:
+  int seed_;
+};
+
 struct NothrowRelocatableInvocationTestFacade : InvocationTestFacade {
   static constexpr auto relocatability = pro::constraint_level::nothrow;
 };
 
+struct TriviallyRelocatableInvocationTestFacade : InvocationTestFacade {
+  static constexpr auto relocatability = pro::constraint_level::trivial;
+};
+
+struct CopyableInvocationTestFacade : InvocationTestFacade {
+  static constexpr auto copyability = pro::constraint_level::nontrivial;
+  static constexpr auto relocatability = pro::constraint_level::nothrow;
+};
+
+struct InPlaceAssignableInvocationTestFacade
+    : pro::facade_builder                           //
+      ::add_facade<InvocationTestFacade>            //
+      ::add_skill<pro::skills::in_place_assignment> //
+      ::build {
+  static constexpr auto copyability = pro::constraint_level::nontrivial;
+  static constexpr auto relocatability = pro::constraint_level::nothrow;
+};
+
 struct InvocationTestBase {
   virtual int Fun() const = 0;
   virtual ~InvocationTestBase() = default;
@@ -26,12 +144,36 @@ struct InvocationTestBase {
 
 std::vector<pro::proxy<InvocationTestFacade>>
     GenerateSmallObjectProxyTestData();
+std::vector<pro::proxy<InvocationTestFacade>>
+    GenerateSmallObjectProxyTestData_TypeRuns(int run_length);
 std::vector<pro::proxy<NothrowRelocatableInvocationTestFacade>>
     GenerateSmallObjectProxyTestData_NothrowRelocatable();
+std::vector<pro::proxy<TriviallyRelocatableInvocationTestFacade>>
+    GenerateSmallObjectProxyTestData_TriviallyRelocatable();
+std::vector<pro::proxy<CopyableInvocationTestFacade>>
+    GenerateSmallObjectProxyTestData_Copyable();
+std::vector<pro::proxy<InPlaceAssignableInvocationTestFacade>>
+    GenerateSmallObjectProxyTestData_InPlaceAssignable();
+template <std::size_t ConventionCount, bool InlineMeta>
+std::vector<pro::proxy<WideInvocationTestFacade<ConventionCount, InlineMeta>>>
+    GenerateSmallObjectProxyTestData_Wide();
+template <std::size_t ConventionCount>
+std::vector<pro::proxy<HotWideInvocationTestFacade<ConventionCount>>>
+    GenerateSmallObjectProxyTestData_HotWide();
+template <class F>
+std::vector<pro::proxy<F>> GenerateSmallObjectProxyTestData_ManyTypes();
 std::vector<pro::proxy<InvocationTestFacade>>
     GenerateSmallObjectProxyTestData_Shared();
+std::vector<pro::proxy<CompactInvocationTestFacade>>
+    GenerateSmallObjectProxyTestData_Compact();
+std::vector<pro::proxy<InvocationTestFacade>>
+    GenerateSmallObjectProxyTestData_Skewed();
+std::vector<pro::proxy<SpeculativeInvocationTestFacade>>
+    GenerateSmallObjectProxyTestData_SkewedSpeculative();
 std::vector<std::unique_ptr<InvocationTestBase>>
     GenerateSmallObjectVirtualFunctionTestData();
+std::vector<std::unique_ptr<InvocationTestBase>>
+    GenerateSmallObjectVirtualFunctionTestData_Skewed();
 std::vector<std::shared_ptr<InvocationTestBase>>
     GenerateSmallObjectVirtualFunctionTestData_Shared();
 std::vector<std::any> GenerateSmallObjectAnyTestData();
@@ -40,8 +182,21 @@ std::vector<pro::proxy<InvocationTestFacade>>
     GenerateLargeObjectProxyTestData();
 std::vector<pro::proxy<NothrowRelocatableInvocationTestFacade>>
     GenerateLargeObjectProxyTestData_NothrowRelocatable();
+std::vector<pro::proxy<CopyableInvocationTestFacade>>
+    GenerateLargeObjectProxyTestData_Copyable();
+std::vector<pro::proxy<InPlaceAssignableInvocationTestFacade>>
+    GenerateLargeObjectProxyTestData_InPlaceAssignable();
 std::vector<pro::proxy<InvocationTestFacade>>
     GenerateLargeObjectProxyTestData_Shared();
+std::vector<pro::proxy<CompactInvocationTestFacade>>
+    GenerateLargeObjectProxyTestData_Compact(pro::compact_arena& arena);
+std::vector<pro::proxy<InvocationTestFacade>>
+    GenerateLargeObjectProxyTestData_FewTypes();
+std::vector<pro::proxy<TaggedInvocationTestFacade>>
+    GenerateLargeObjectProxyTestData_Tagged();
+template <class F>
+std::vector<pro::proxy<F>> GenerateLargeObjectProxyTestData_RawPtr(
+    std::vector<std::shared_ptr<void>>& objects);
 std::vector<std::unique_ptr<InvocationTestBase>>
     GenerateLargeObjectVirtualFunctionTestData();
 std::vector<std::shared_ptr<InvocationTestBase>>
@@ -20,6 +20,11 @@
 
 #if __STDC_HOSTED__
 #include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <span>
+#include <vector>
 #if __has_include(<format>)
 #include <format>
 #endif // __has_include(<format>)
@@ -77,6 +82,10 @@ template <facade F>
 class proxy_indirect_accessor;
 template <facade F>
 class PRO4D_ENFORCE_EBO proxy;
+#if __STDC_HOSTED__
+class compact_arena;
+class proxy_arena;
+#endif // __STDC_HOSTED__
 
 template <class T>
 struct is_bitwise_trivially_relocatable
@@ -224,6 +233,14 @@ template <class T>
 struct destructibility_traits<T, constraint_level::trivial>
     : applicable_traits {};
 
+template <class F, bool IsDirect, class D, class O>
+struct invocation_meta;
+template <class F>
+struct facade_meta_ptr_traits;
+template <class F>
+using facade_meta_ptr = typename facade_meta_ptr_traits<F>::type;
+struct lifetime_flags_meta;
+
 struct proxy_helper {
   template <class P, class F>
   struct resetting_guard {
@@ -237,20 +254,180 @@ struct proxy_helper {
     proxy<F>& p_;
   };
 
+  // Materializes the pointer of a tagged proxy for the duration of a call.
+  // The pointer is bitwise trivially relocatable, so the copy stands in for
+  // the original, and any change to it is written back afterwards.
+  template <class P, class F, qualifier_type Q>
+  class tagged_ptr_guard {
+  public:
+    explicit tagged_ptr_guard(add_qualifier_t<proxy<F>, Q> p) noexcept
+        : p_(p) {
+      std::uintptr_t address = p.meta_.address();
+      std::uninitialized_copy_n(reinterpret_cast<const std::byte*>(&address),
+                                sizeof(P), storage_);
+    }
+    ~tagged_ptr_guard() noexcept(Q != qualifier_type::rv ||
+                                 std::is_nothrow_destructible_v<P>) {
+      if constexpr (Q == qualifier_type::lv) {
+        p_.meta_.set_address(std::bit_cast<std::uintptr_t>(storage_));
+      } else if constexpr (Q == qualifier_type::rv) {
+        std::destroy_at(std::launder(reinterpret_cast<P*>(storage_)));
+        p_.meta_.reset();
+      }
+    }
+
+    add_qualifier_t<P, Q> get() noexcept {
+      return static_cast<add_qualifier_t<P, Q>>(
+          *std::launder(reinterpret_cast<P*>(storage_)));
+    }
+
+  private:
+    std::remove_reference_t<add_qualifier_t<proxy<F>, Q>>& p_;
+    alignas(P) std::byte storage_[sizeof(P)];
+  };
+
+  // Materializes the pointer of a stateless proxy for the duration of a call.
+  // The pointer is empty and trivially copyable, so a fresh object stands in
+  // for the one that was never stored.
+  template <class P, class F, qualifier_type Q>
+  class stateless_ptr_guard {
+  public:
+    explicit stateless_ptr_guard(add_qualifier_t<proxy<F>, Q> p) noexcept
+        : p_(p) {}
+    ~stateless_ptr_guard() noexcept {
+      if constexpr (Q == qualifier_type::rv) {
+        p_.meta_.reset();
+      }
+    }
+
+    add_qualifier_t<P, Q> get() noexcept {
+      return static_cast<add_qualifier_t<P, Q>>(
+          *std::launder(reinterpret_cast<P*>(storage_)));
+    }
+
+  private:
+    std::remove_reference_t<add_qualifier_t<proxy<F>, Q>>& p_;
+    alignas(P) std::byte storage_[sizeof(P)];
+  };
+
   template <class F>
   static const auto& get_meta(const proxy<F>& p) noexcept {
     assert(p.has_value());
     return *p.meta_.operator->();
   }
+  template <bool IsDirect, class D, class O, class F>
+  static const auto& get_invocation_meta(const proxy<F>& p) noexcept {
+    assert(p.has_value());
+    using IM = invocation_meta<F, IsDirect, D, O>;
+    using traits = facade_meta_ptr_traits<F>;
+    if constexpr (traits::template is_shared<IM>) {
+      return static_cast<const typename traits::template shared_t<IM>&>(
+          *p.meta_.template get<typename traits::shared_ref>().table);
+    } else {
+      return p.meta_.template get<IM>();
+    }
+  }
   template <class P, class F, qualifier_type Q>
   static add_qualifier_t<P, Q> get_ptr(add_qualifier_t<proxy<F>, Q> p) {
     return static_cast<add_qualifier_t<P, Q>>(
         *std::launder(reinterpret_cast<add_qualifier_ptr_t<P, Q>>(p.ptr_)));
   }
+  template <class F>
+  static std::byte* get_storage(proxy<F>& p) noexcept {
+    return p.ptr_;
+  }
+  template <class F>
+  static const std::byte* get_storage(const proxy<F>& p) noexcept {
+    return p.ptr_;
+  }
+  template <class F>
+  static std::uintptr_t get_word(const proxy<F>& p) noexcept {
+    if constexpr (facade_meta_ptr_traits<F>::is_tagged) {
+      return p.meta_.address();
+    } else {
+      std::uintptr_t word;
+      std::uninitialized_copy_n(p.ptr_, sizeof(word),
+                                reinterpret_cast<std::byte*>(&word));
+      return word;
+    }
+  }
+  template <class B>
+  static auto get_proxies(const B& b) noexcept {
+    return b.proxies_;
+  }
+  template <class P, class F>
+  static bool is_meta_of(const proxy<F>& p) noexcept {
+    return p.meta_.template is_meta_of<P>();
+  }
+  template <class F>
+  static bool is_same_meta(const proxy<F>& lhs, const proxy<F>& rhs) noexcept {
+    return lhs.meta_ == rhs.meta_;
+  }
+#if __STDC_HOSTED__
+  // Whether two proxy objects are empty or contain pointers of the same type
+  // whose first word is equal, e.g., shared pointers to the same value.
+  template <class F>
+  static bool is_same_pointer(const proxy<F>& lhs,
+                              const proxy<F>& rhs) noexcept {
+    if (!(lhs.meta_ == rhs.meta_)) {
+      return false;
+    }
+    if (!lhs.meta_.has_value()) {
+      return true;
+    }
+    if constexpr (facade_meta_ptr_traits<F>::is_tagged) {
+      return lhs.meta_.address() == rhs.meta_.address();
+    } else if constexpr (facade_meta_ptr_traits<F>::is_stateless) {
+      return true;
+    } else {
+      return std::memcmp(lhs.ptr_, rhs.ptr_, sizeof(void*)) == 0;
+    }
+  }
+#endif // __STDC_HOSTED__
+  template <class F>
+  static void release(proxy<F>& p) noexcept {
+    p.meta_.reset();
+  }
+  template <class F>
+  static const facade_meta_ptr<F>& get_meta_ptr(const proxy<F>& p) noexcept {
+    return p.meta_;
+  }
+  template <bool lifetime_flags_meta::* Flag, class F>
+  static bool has_lifetime_flag(const proxy<F>& p) noexcept {
+    return proxy<F>::template has_lifetime_flag<Flag>(p);
+  }
   template <class P, class F1, class F2>
   static void trivially_relocate(proxy<F1>& from, proxy<F2>& to) noexcept {
-    std::uninitialized_copy_n(from.ptr_, sizeof(P), to.ptr_);
-    to.meta_ = decltype(proxy<F2>::meta_){std::in_place_type<P>};
+    if constexpr (facade_meta_ptr_traits<F1>::is_tagged ||
+                  facade_meta_ptr_traits<F2>::is_tagged) {
+      std::uintptr_t address;
+      if constexpr (facade_meta_ptr_traits<F1>::is_tagged) {
+        address = from.meta_.address();
+      } else {
+        std::uninitialized_copy_n(from.ptr_, sizeof(P),
+                                  reinterpret_cast<std::byte*>(&address));
+      }
+      to.meta_ = decltype(proxy<F2>::meta_){std::in_place_type<P>};
+      if constexpr (facade_meta_ptr_traits<F2>::is_tagged) {
+        to.meta_.set_address(address);
+      } else {
+        std::uninitialized_copy_n(reinterpret_cast<const std::byte*>(&address),
+                                  sizeof(P), to.ptr_);
+      }
+    } else if constexpr (facade_meta_ptr_traits<F1>::is_stateless ||
+                         facade_meta_ptr_traits<F2>::is_stateless) {
+      // The pointer is empty, so it is only materialized if F2 stores it.
+      if constexpr (!facade_meta_ptr_traits<F2>::is_stateless) {
+        alignas(P) std::byte storage[sizeof(P)];
+        std::construct_at(
+            reinterpret_cast<P*>(to.ptr_),
+            std::move(*std::launder(reinterpret_cast<P*>(storage))));
+      }
+      to.meta_ = decltype(proxy<F2>::meta_){std::in_place_type<P>};
+    } else {
+      std::uninitialized_copy_n(from.ptr_, sizeof(P), to.ptr_);
+      to.meta_ = decltype(proxy<F2>::meta_){std::in_place_type<P>};
+    }
     from.meta_.reset();
   }
 };
@@ -298,20 +475,28 @@ template <class P, class F, bool IsDirect, class D, qualifier_type Q, bool NE,
           class R, class... Args>
 R invoke_dispatch(add_qualifier_t<proxy<F>, Q> self,
                   Args... args) noexcept(NE) {
-  if constexpr (Q == qualifier_type::rv) {
-    if constexpr (std::is_base_of_v<internal_dispatch, D> &&
-                  is_bitwise_trivially_relocatable_v<P>) {
-      static_assert(IsDirect);
-      return D{}(std::in_place_type<P>,
-                 std::forward<add_qualifier_t<proxy<F>, Q>>(self),
-                 std::forward<Args>(args)...);
-    } else {
-      proxy_helper::resetting_guard<P, F> guard{self};
-      return invoke_dispatch_impl<D, R>(
-          get_operand<IsDirect>(
-              proxy_helper::get_ptr<P, F, Q>(std::move(self))),
-          std::forward<Args>(args)...);
-    }
+  if constexpr (Q == qualifier_type::rv &&
+                std::is_base_of_v<internal_dispatch, D> &&
+                is_bitwise_trivially_relocatable_v<P>) {
+    static_assert(IsDirect);
+    return D{}(std::in_place_type<P>,
+               std::forward<add_qualifier_t<proxy<F>, Q>>(self),
+               std::forward<Args>(args)...);
+  } else if constexpr (facade_meta_ptr_traits<F>::is_tagged) {
+    proxy_helper::tagged_ptr_guard<P, F, Q> guard{
+        std::forward<add_qualifier_t<proxy<F>, Q>>(self)};
+    return invoke_dispatch_impl<D, R>(get_operand<IsDirect>(guard.get()),
+                                      std::forward<Args>(args)...);
+  } else if constexpr (facade_meta_ptr_traits<F>::is_stateless) {
+    proxy_helper::stateless_ptr_guard<P, F, Q> guard{
+        std::forward<add_qualifier_t<proxy<F>, Q>>(self)};
+    return invoke_dispatch_impl<D, R>(get_operand<IsDirect>(guard.get()),
+                                      std::forward<Args>(args)...);
+  } else if constexpr (Q == qualifier_type::rv) {
+    proxy_helper::resetting_guard<P, F> guard{self};
+    return invoke_dispatch_impl<D, R>(
+        get_operand<IsDirect>(proxy_helper::get_ptr<P, F, Q>(std::move(self))),
+        std::forward<Args>(args)...);
   } else {
     return invoke_dispatch_impl<D, R>(
         get_operand<IsDirect>(proxy_helper::get_ptr<P, F, Q>(
@@ -320,18 +505,158 @@ R invoke_dispatch(add_qualifier_t<proxy<F>, Q> self,
   }
 }
 
+// Marker reflection added by skills::register_dispatch. Only pointers that
+// refer to their pointee regardless of their own address can be passed as a
+// copy of their word. This cannot be detected in general: values stored inline
+// are excluded here, and skills_register_dispatch.md states the requirement
+// for other pointer types.
+template <class T>
+class inplace_ptr;
+template <class P>
+constexpr bool is_register_passable_ptr =
+    sizeof(P) == sizeof(std::uintptr_t) && std::is_trivially_copyable_v<P>;
+template <class T>
+constexpr bool is_register_passable_ptr<inplace_ptr<T>> = false;
+struct register_dispatch_reflector {
+  register_dispatch_reflector() = default;
+  template <class P>
+    requires(is_register_passable_ptr<P>)
+  constexpr explicit register_dispatch_reflector(
+      std::in_place_type_t<P>) noexcept {}
+};
+template <class... Rs>
+struct register_dispatch_traits
+    : std::bool_constant<(std::is_same_v<typename Rs::reflector_type,
+                                         register_dispatch_reflector> ||
+                          ...)> {};
+
+template <class P, class D, qualifier_type Q, bool NE, class R, class... Args>
+R invoke_register_dispatch(std::uintptr_t word, Args... args) noexcept(NE) {
+  P ptr = std::bit_cast<P>(word);
+  return invoke_dispatch_impl<D, R>(
+      get_operand<false>(static_cast<add_qualifier_t<P, Q>>(ptr)),
+      std::forward<Args>(args)...);
+}
+
+// Marker reflection added by skills::shared_meta. The dispatchers of a facade
+// carrying it receive the storage of the contained pointer instead of the
+// proxy, so that they do not depend on the facade and can be shared, unless the
+// pointer is not stored in the proxy.
+struct tagged_meta_reflector;
+struct stateless_meta_reflector;
+struct shared_meta_reflector {
+  shared_meta_reflector() = default;
+  template <class P>
+  constexpr explicit shared_meta_reflector(std::in_place_type_t<P>) noexcept {}
+};
+template <class... Rs>
+struct shared_meta_traits
+    : std::bool_constant<
+          (std::is_same_v<typename Rs::reflector_type, shared_meta_reflector> ||
+           ...)> {};
+template <class... Rs>
+struct detached_ptr_traits
+    : std::bool_constant<(
+          (std::is_same_v<typename Rs::reflector_type, tagged_meta_reflector> ||
+           std::is_same_v<typename Rs::reflector_type,
+                          stateless_meta_reflector>) ||
+          ...)> {};
+template <class F>
+constexpr bool has_shared_meta =
+    instantiated_t<shared_meta_traits, typename F::reflection_types>::value;
+
+template <class P, bool IsDirect, class D, qualifier_type Q, bool NE, class R,
+          class... Args>
+R invoke_storage_dispatch(add_qualifier_ptr_t<std::byte, Q> storage,
+                          Args... args) noexcept(NE) {
+  return invoke_dispatch_impl<D, R>(
+      get_operand<IsDirect>(static_cast<add_qualifier_t<P, Q>>(
+          *std::launder(reinterpret_cast<add_qualifier_ptr_t<P, Q>>(storage)))),
+      std::forward<Args>(args)...);
+}
+
 template <class O>
 struct overload_traits : inapplicable_traits {};
 template <qualifier_type Q, bool NE, class R, class... Args>
 struct overload_traits_impl : applicable_traits {
   using return_type = R;
-  template <class F>
-  using dispatcher_type = R (*)(add_qualifier_t<proxy<F>, Q>,
-                                Args...) noexcept(NE);
-
+  // Whether the overload can be invoked on each element of a sequence of
+  // (const) proxies with the same arguments, which are passed as lvalues.
+  template <bool IsConst>
+  static constexpr bool is_batch_applicable =
+      (Q == qualifier_type::const_lv ||
+       (!IsConst && Q == qualifier_type::lv)) &&
+      (!std::is_rvalue_reference_v<Args> && ...);
+  static constexpr bool is_batch_invocable =
+      std::is_void_v<R> && is_batch_applicable<false>;
+
+  // Whether the dispatcher receives the word of the pointer by value instead of
+  // a reference to the proxy, which saves the callee from reloading it.
+  template <class F, bool IsDirect>
+  static constexpr bool is_register_dispatch =
+      !IsDirect && Q != qualifier_type::rv &&
+      instantiated_t<register_dispatch_traits,
+                     typename F::reflection_types>::value;
+  // Whether the dispatcher receives the address of the storage of the pointer
+  // instead of a reference to the proxy, so that it does not depend on F.
+  template <class F, bool IsDirect>
+  static constexpr bool is_storage_dispatch =
+      !is_register_dispatch<F, IsDirect> && Q != qualifier_type::rv &&
+      has_shared_meta<F> &&
+      !instantiated_t<detached_ptr_traits, typename F::reflection_types>::value;
+  template <class F, bool IsDirect>
+  static constexpr bool is_shared_dispatch =
+      has_shared_meta<F> &&
+      (is_register_dispatch<F, IsDirect> || is_storage_dispatch<F, IsDirect>);
+
+  template <bool IsRegister>
+  using shared_dispatcher_type = std::conditional_t<
+      IsRegister, R (*)(std::uintptr_t, Args...) noexcept(NE),
+      R (*)(add_qualifier_ptr_t<std::byte, Q>, Args...) noexcept(NE)>;
+  template <class F, bool IsDirect>
+  using dispatcher_type = std::conditional_t<
+      is_register_dispatch<F, IsDirect> || is_storage_dispatch<F, IsDirect>,
+      shared_dispatcher_type<is_register_dispatch<F, IsDirect>>,
+      R (*)(add_qualifier_t<proxy<F>, Q>, Args...) noexcept(NE)>;
+
+  template <class P, bool IsDirect, bool IsRegister, class D>
+  static consteval shared_dispatcher_type<IsRegister>
+      select_shared_dispatcher() {
+    if constexpr (IsRegister) {
+      return &invoke_register_dispatch<P, D, Q, NE, R, Args...>;
+    } else {
+      return &invoke_storage_dispatch<P, IsDirect, D, Q, NE, R, Args...>;
+    }
+  }
+  template <class P, class F, bool IsDirect, class D>
+  static consteval dispatcher_type<F, IsDirect> select_dispatcher() {
+    if constexpr (is_register_dispatch<F, IsDirect> ||
+                  is_storage_dispatch<F, IsDirect>) {
+      return select_shared_dispatcher<P, IsDirect,
+                                      is_register_dispatch<F, IsDirect>, D>();
+    } else {
+      return &invoke_dispatch<P, F, IsDirect, D, Q, NE, R, Args...>;
+    }
+  }
+  template <class P, bool IsDirect, bool IsRegister, class D>
+  static constexpr shared_dispatcher_type<IsRegister> shared_dispatcher =
+      select_shared_dispatcher<P, IsDirect, IsRegister, D>();
   template <class P, class F, bool IsDirect, class D>
-  static constexpr auto dispatcher =
-      &invoke_dispatch<P, F, IsDirect, D, Q, NE, R, Args...>;
+  static constexpr dispatcher_type<F, IsDirect> dispatcher =
+      select_dispatcher<P, F, IsDirect, D>();
+
+  // Converts a proxy to the first argument of dispatcher_type<F, IsDirect>.
+  template <class F, bool IsDirect>
+  static decltype(auto)
+      dispatcher_operand(add_qualifier_t<proxy<F>, Q> self) noexcept {
+    if constexpr (is_register_dispatch<F, IsDirect>) {
+      return proxy_helper::get_word(self);
+    } else if constexpr (is_storage_dispatch<F, IsDirect>) {
+      return proxy_helper::get_storage(self);
+    } else {
+      return std::forward<add_qualifier_t<proxy<F>, Q>>(self);
+    }
+  }
 
   template <class P, bool IsDirect, class D>
   static constexpr bool applicable_ptr =
@@ -409,7 +734,8 @@ struct invocation_meta {
       : dispatcher(overload_traits<O>::template dispatcher<P, F, IsDirect, D>) {
   }
 
-  typename overload_traits<O>::template dispatcher_type<F> dispatcher;
+  typename overload_traits<O>::template dispatcher_type<F, IsDirect>
+      dispatcher;
 };
 
 template <class... Ms>
@@ -420,6 +746,37 @@ struct PRO4D_ENFORCE_EBO composite_meta : Ms... {
       : Ms(std::in_place_type<P>)... {}
 };
 
+// The counterpart of invocation_meta that does not depend on the facade, whose
+// dispatcher receives either the word of the pointer (IsRegister) or the
+// address of its storage.
+template <bool IsDirect, bool IsRegister, class D, class O>
+struct shared_invocation_meta {
+  shared_invocation_meta() = default;
+  template <class P>
+  constexpr explicit shared_invocation_meta(std::in_place_type_t<P>)
+      : dispatcher(overload_traits<O>::template shared_dispatcher<
+                   P, IsDirect, IsRegister, D>) {}
+
+  typename overload_traits<O>::template shared_dispatcher_type<IsRegister>
+      dispatcher;
+};
+
+// Refers to the shared invocation metas (SM) of a pointer type, which are
+// stored once for all the facades that have them in common.
+template <class SM>
+struct shared_meta_ref {
+  shared_meta_ref() = default;
+  template <class P>
+  constexpr explicit shared_meta_ref(std::in_place_type_t<P>)
+      : table(&storage<P>) {}
+
+  const SM* table;
+
+private:
+  template <class P>
+  static constexpr SM storage{std::in_place_type<P>};
+};
+
 template <class T>
 consteval bool is_is_direct_well_formed() {
   if constexpr (requires {
@@ -491,6 +848,9 @@ struct conv_traits_impl<C, F, Os...> : applicable_traits {
       (overload_traits<substituted_overload_t<Os, F>>::template applicable_ptr<
            P, C::is_direct, typename C::dispatch_type> &&
        ...);
+  static constexpr bool is_batch_invocable =
+      (overload_traits<substituted_overload_t<Os, F>>::is_batch_invocable &&
+       ...);
 };
 template <class C, class F>
 struct conv_traits
@@ -594,6 +954,81 @@ struct lifetime_meta_traits<F, D, ONE, OE, constraint_level::nontrivial>
 template <class F, class D, class ONE, class OE, constraint_level C>
 using lifetime_meta_t = typename lifetime_meta_traits<F, D, ONE, OE, C>::type;
 
+// Lifetime operations between two proxies that contain the same pointer type,
+// enabled by skills::in_place_assignment.
+struct assign_dispatch {
+  template <class T>
+    requires(std::is_copy_assignable_v<T>)
+  PRO4D_STATIC_CALL(void, T& self, const T& rhs) noexcept(
+      std::is_nothrow_copy_assignable_v<T>) {
+    self = rhs;
+  }
+};
+struct swap_dispatch {
+  template <class T>
+    requires(std::is_nothrow_swappable_v<T>)
+  PRO4D_STATIC_CALL(void, T& self, T& rhs) noexcept {
+    using std::swap;
+    swap(self, rhs);
+  }
+};
+template <class P, class F, class D, qualifier_type Q, bool NE>
+void same_type_dispatch(proxy<F>& self,
+                        add_qualifier_t<proxy<F>, Q> rhs) noexcept(NE) {
+  D{}(proxy_helper::get_ptr<P, F, qualifier_type::lv>(self),
+      proxy_helper::get_ptr<P, F, Q>(rhs));
+}
+// The dispatcher is null for pointer types that do not support D, in which
+// case the proxy falls back to the generic lifetime operations.
+template <class F, class D, qualifier_type Q, bool NE>
+struct same_type_meta {
+  using dispatcher_type = void (*)(proxy<F>&,
+                                   add_qualifier_t<proxy<F>, Q>) noexcept(NE);
+
+  same_type_meta() = default;
+  template <class P>
+  constexpr explicit same_type_meta(std::in_place_type_t<P>)
+      : dispatcher(select_dispatcher<P>()) {}
+
+  dispatcher_type dispatcher;
+
+private:
+  template <class P>
+  static consteval dispatcher_type select_dispatcher() {
+    if constexpr (NE ? std::is_nothrow_invocable_v<D, P&, add_qualifier_t<P, Q>>
+                     : std::is_invocable_v<D, P&, add_qualifier_t<P, Q>>) {
+      return &same_type_dispatch<P, F, D, Q, NE>;
+    } else {
+      return nullptr;
+    }
+  }
+};
+template <class F>
+using assign_meta =
+    same_type_meta<F, assign_dispatch, qualifier_type::const_lv,
+                   F::copyability == constraint_level::nothrow>;
+template <class F>
+using swap_meta = same_type_meta<F, swap_dispatch, qualifier_type::lv, true>;
+
+// Marker reflection added by skills::in_place_assignment.
+struct in_place_assignment_reflector {
+  in_place_assignment_reflector() = default;
+  template <class P>
+  constexpr explicit in_place_assignment_reflector(
+      std::in_place_type_t<P>) noexcept {}
+};
+template <class... Rs>
+struct in_place_assignment_traits
+    : std::bool_constant<(std::is_same_v<typename Rs::reflector_type,
+                                         in_place_assignment_reflector> ||
+                          ...)> {};
+template <class F, template <class> class M, constraint_level C>
+using in_place_lifetime_meta_t = std::conditional_t<
+    instantiated_t<in_place_assignment_traits,
+                   typename F::reflection_types>::value &&
+        (C == constraint_level::nontrivial || C == constraint_level::nothrow),
+    M<F>, void>;
+
 template <class... As>
 struct PRO4D_ENFORCE_EBO composite_accessor : As... {};
 
@@ -786,6 +1221,8 @@ struct facade_traits<F>
                       void(proxy<F>&) &&, F::relocatability>,
       lifetime_meta_t<F, destroy_dispatch, void() noexcept, void(),
                       F::destructibility>,
+      in_place_lifetime_meta_t<F, assign_meta, F::copyability>,
+      in_place_lifetime_meta_t<F, swap_meta, F::relocatability>,
       typename facade_traits::conv_meta, typename facade_traits::refl_meta>;
   using indirect_accessor =
       composite_t<typename facade_traits::conv_indirect_accessor,
@@ -828,6 +1265,22 @@ struct facade_traits<F>
 
 using ptr_prototype = void* [2];
 
+template <class T>
+bool is_bitwise_equal(const T& lhs, const T& rhs) noexcept {
+  struct repr {
+    unsigned char value[sizeof(T)];
+  };
+  repr l = std::bit_cast<repr>(lhs), r = std::bit_cast<repr>(rhs);
+  for (std::size_t i = 0; i < sizeof(T); ++i) {
+    if (l.value[i] != r.value[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Two meta pointers compare equal if they either both hold no value, or both
+// dispatch every convention to the same implementation.
 template <class M>
 struct meta_ptr_indirect_impl {
   meta_ptr_indirect_impl() = default;
@@ -837,19 +1290,96 @@ struct meta_ptr_indirect_impl {
   bool has_value() const noexcept { return ptr_ != nullptr; }
   void reset() noexcept { ptr_ = nullptr; }
   const M* operator->() const noexcept { return ptr_; }
+  template <class IM>
+  const IM& get() const noexcept {
+    return *ptr_;
+  }
+  template <class P>
+  bool is_meta_of() const noexcept {
+    return ptr_ == &storage<P>;
+  }
+  friend bool operator==(const meta_ptr_indirect_impl&,
+                         const meta_ptr_indirect_impl&) noexcept = default;
+
+protected:
+  explicit meta_ptr_indirect_impl(const M* ptr) noexcept : ptr_(ptr) {}
 
 private:
   const M* ptr_;
   template <class P>
   static constexpr M storage{std::in_place_type<P>};
 };
+// The member of the leading meta (DM) of a meta embedded in a proxy, which is
+// null if and only if the proxy is empty.
+template <class DM>
+constexpr auto direct_meta_key = &DM::dispatcher;
+template <class SM>
+constexpr auto direct_meta_key<shared_meta_ref<SM>> =
+    &shared_meta_ref<SM>::table;
 template <class M, class DM>
 struct meta_ptr_direct_impl : private M {
   using M::M;
-  bool has_value() const noexcept { return this->DM::dispatcher != nullptr; }
-  void reset() noexcept { this->DM::dispatcher = nullptr; }
+  bool has_value() const noexcept {
+    return this->*direct_meta_key<DM> != nullptr;
+  }
+  void reset() noexcept { this->*direct_meta_key<DM> = nullptr; }
   const M* operator->() const noexcept { return this; }
+  template <class IM>
+  const IM& get() const noexcept {
+    return *this;
+  }
+  template <class P>
+  bool is_meta_of() const noexcept {
+    return *this == meta_ptr_direct_impl{std::in_place_type<P>};
+  }
+  friend bool operator==(const meta_ptr_direct_impl& lhs,
+                         const meta_ptr_direct_impl& rhs) noexcept {
+    if (!lhs.has_value() || !rhs.has_value()) {
+      return lhs.has_value() == rhs.has_value();
+    }
+    if constexpr (std::has_unique_object_representations_v<M>) {
+      return is_bitwise_equal<M>(lhs, rhs);
+    } else {
+      return lhs.*direct_meta_key<DM> == rhs.*direct_meta_key<DM>;
+    }
+  }
+};
+// Stores the invocation metas of the hot conventions (HM) in the proxy, and
+// everything else (CM) out of line, referenced by a CMP.
+template <class CM, class HM, class CMP = meta_ptr_indirect_impl<CM>>
+struct meta_ptr_split_impl : private HM {
+  meta_ptr_split_impl() = default;
+  template <class P>
+  explicit meta_ptr_split_impl(std::in_place_type_t<P>)
+      : HM(std::in_place_type<P>), cold_(std::in_place_type<P>) {}
+  bool has_value() const noexcept { return cold_.has_value(); }
+  void reset() noexcept { cold_.reset(); }
+  const CM* operator->() const noexcept { return cold_.operator->(); }
+  template <class IM>
+  const IM& get() const noexcept {
+    if constexpr (std::is_base_of_v<IM, HM>) {
+      return *this;
+    } else {
+      return *cold_.operator->();
+    }
+  }
+  template <class P>
+  bool is_meta_of() const noexcept {
+    return cold_.template is_meta_of<P>();
+  }
+  friend bool operator==(const meta_ptr_split_impl& lhs,
+                         const meta_ptr_split_impl& rhs) noexcept {
+    return lhs.cold_ == rhs.cold_;
+  }
+
+private:
+  CMP cold_;
 };
+template <class MP>
+constexpr bool is_direct_meta_ptr = false;
+template <class M, class DM>
+constexpr bool is_direct_meta_ptr<meta_ptr_direct_impl<M, DM>> = true;
+
 template <class M>
 struct meta_ptr_traits_impl : std::type_identity<meta_ptr_indirect_impl<M>> {};
 template <class F, bool IsDirect, class D, class O, class... Ms>
@@ -858,58 +1388,593 @@ struct meta_ptr_traits_impl<
     : std::type_identity<meta_ptr_direct_impl<
           composite_meta<invocation_meta<F, IsDirect, D, O>, Ms...>,
           invocation_meta<F, IsDirect, D, O>>> {};
-template <class M>
+template <class SM, class... Ms>
+struct meta_ptr_traits_impl<composite_meta<shared_meta_ref<SM>, Ms...>>
+    : std::type_identity<
+          meta_ptr_direct_impl<composite_meta<shared_meta_ref<SM>, Ms...>,
+                               shared_meta_ref<SM>>> {};
+template <class M, std::size_t MaxSize>
 struct meta_ptr_traits : std::type_identity<meta_ptr_indirect_impl<M>> {};
-template <class M>
-  requires(sizeof(M) <= sizeof(ptr_prototype) &&
-           alignof(M) <= alignof(ptr_prototype) &&
+template <class M, std::size_t MaxSize>
+  requires(sizeof(M) <= MaxSize && alignof(M) <= alignof(ptr_prototype) &&
            std::is_nothrow_default_constructible_v<M> &&
            std::is_trivially_copyable_v<M>)
-struct meta_ptr_traits<M> : meta_ptr_traits_impl<M> {};
-template <class M>
-using meta_ptr = typename meta_ptr_traits<M>::type;
+struct meta_ptr_traits<M, MaxSize> : meta_ptr_traits_impl<M> {};
+template <class M, std::size_t MaxSize>
+using meta_ptr = typename meta_ptr_traits<M, MaxSize>::type;
+
+// Marker reflection added by basic_facade_builder::inline_meta<N>. The meta of
+// a facade carrying it is embedded in the proxy if it fits in N pointers.
+template <std::size_t N>
+struct inline_meta_reflector {
+  inline_meta_reflector() = default;
+  template <class P>
+  constexpr explicit inline_meta_reflector(std::in_place_type_t<P>) noexcept {}
+};
+template <class R>
+constexpr std::size_t inline_meta_slots = 0u;
+template <std::size_t N>
+constexpr std::size_t inline_meta_slots<inline_meta_reflector<N>> = N;
+template <class... Rs>
+consteval std::size_t max_inline_meta_size() {
+  std::size_t result = sizeof(ptr_prototype);
+  ((result = inline_meta_slots<typename Rs::reflector_type> * sizeof(void*) >
+                     result
+                 ? inline_meta_slots<typename Rs::reflector_type> *
+                       sizeof(void*)
+                 : result),
+   ...);
+  return result;
+}
+template <class... Rs>
+struct inline_meta_size_traits
+    : std::integral_constant<std::size_t, max_inline_meta_size<Rs...>()> {};
+template <class... Rs>
+struct inline_meta_traits
+    : std::bool_constant<((inline_meta_slots<typename Rs::reflector_type> >
+                           0u) ||
+                          ...)> {};
+
+// Marker reflection added by basic_facade_builder::add_hot_convention. The
+// invocation metas of convention C are stored in the proxy when the meta of the
+// facade is not embedded as a whole.
+template <class C>
+struct hot_conv_reflector {
+  hot_conv_reflector() = default;
+  template <class P>
+  constexpr explicit hot_conv_reflector(std::in_place_type_t<P>) noexcept {}
+};
+template <class F, class R>
+struct hot_meta_traits : std::type_identity<composite_meta<>> {};
+template <class F, class C>
+struct hot_meta_traits<F, hot_conv_reflector<C>>
+    : std::type_identity<typename conv_traits<C, F>::meta> {};
+template <class O, class I>
+struct unique_meta_reduction : std::type_identity<O> {};
+template <class... Os, class I>
+  requires(!std::is_same_v<I, Os> && ...)
+struct unique_meta_reduction<composite_meta<Os...>, I>
+    : std::type_identity<composite_meta<Os..., I>> {};
+template <class O, class I>
+struct hot_meta_reduction;
+template <class O, class... Is>
+struct hot_meta_reduction<O, composite_meta<Is...>>
+    : recursive_reduction<
+          reduction_traits<unique_meta_reduction>::template type, O, Is...> {};
+template <class F, class... Rs>
+using hot_meta_t = recursive_reduction_t<
+    reduction_traits<hot_meta_reduction>::template type, composite_meta<>,
+    typename hot_meta_traits<F, typename Rs::reflector_type>::type...>;
+template <class HM, class O, class I>
+struct cold_meta_reduction : std::type_identity<O> {};
+template <class HM, class... Os, class I>
+  requires(!std::is_base_of_v<I, HM>)
+struct cold_meta_reduction<HM, composite_meta<Os...>, I>
+    : std::type_identity<composite_meta<Os..., I>> {};
+template <class M, class HM>
+struct cold_meta_traits;
+template <class... Ms, class HM>
+struct cold_meta_traits<composite_meta<Ms...>, HM>
+    : recursive_reduction<
+          reduction_traits<cold_meta_reduction, HM>::template type,
+          composite_meta<>, Ms...> {};
+
+// Moves the invocation metas of the conventions that are not hot (HM) and
+// whose dispatchers do not depend on the facade out of a meta, into a table
+// shared by all the facades that have the same ones (see skills::shared_meta).
+// Copying constructs a proxy of the facade, and is never shared.
+template <class HM, class I>
+struct shared_invocation_traits : inapplicable_traits {
+  using type = void;
+};
+template <class HM, class F, bool IsDirect, class D, class O>
+  requires(overload_traits<O>::template is_shared_dispatch<F, IsDirect> &&
+           !std::is_same_v<D, copy_dispatch> &&
+           !std::is_base_of_v<invocation_meta<F, IsDirect, D, O>, HM>)
+struct shared_invocation_traits<HM, invocation_meta<F, IsDirect, D, O>>
+    : applicable_traits {
+  using type = shared_invocation_meta<
+      IsDirect, overload_traits<O>::template is_register_dispatch<F, IsDirect>,
+      D, O>;
+};
+template <class M, class HM>
+struct shared_meta_split_traits;
+template <class... Ms, class HM>
+struct shared_meta_split_traits<composite_meta<Ms...>, HM> {
+  using shared_meta = composite_t<
+      composite_meta<>, typename shared_invocation_traits<HM, Ms>::type...>;
+  using shared_ref = std::conditional_t<std::is_same_v<shared_meta,
+                                                       composite_meta<>>,
+                                        void, shared_meta_ref<shared_meta>>;
+  using type = composite_t<
+      composite_meta<>, shared_ref,
+      std::conditional_t<shared_invocation_traits<HM, Ms>::applicable, void,
+                         Ms>...>;
+};
 
+#if __STDC_HOSTED__
+// Marker reflection added by skills::compact.
+struct compact_meta_reflector {
+  compact_meta_reflector() = default;
+  template <class P>
+  constexpr explicit compact_meta_reflector(std::in_place_type_t<P>) noexcept {}
+};
+template <class... Rs>
+struct compact_meta_traits
+    : std::bool_constant<(std::is_same_v<typename Rs::reflector_type,
+                                         compact_meta_reflector> ||
+                          ...)> {};
+
+// Marker reflection added by skills::tagged. Only pointers that are stored as
+// a single address can share their word with a tag, and the low bits of the
+// address are only known to be clear if the pointee is aligned to a word.
+template <class P>
+constexpr bool is_taggable_ptr =
+    sizeof(P) == sizeof(std::uintptr_t) &&
+    is_bitwise_trivially_relocatable_v<P> && requires {
+      requires alignof(typename std::pointer_traits<P>::element_type) >=
+                   alignof(std::uintptr_t);
+    };
 template <class T>
-class inplace_ptr {
+constexpr bool is_taggable_ptr<inplace_ptr<T>> = false;
+struct tagged_meta_reflector {
+  tagged_meta_reflector() = default;
+  template <class P>
+    requires(is_taggable_ptr<P>)
+  constexpr explicit tagged_meta_reflector(std::in_place_type_t<P>) noexcept {}
+};
+template <class... Rs>
+struct tagged_meta_traits
+    : std::bool_constant<
+          (std::is_same_v<typename Rs::reflector_type, tagged_meta_reflector> ||
+           ...)> {};
+
+// Marker reflection added by skills::thread_caching.
+struct thread_caching_reflector {
+  thread_caching_reflector() = default;
+  template <class P>
+  constexpr explicit thread_caching_reflector(
+      std::in_place_type_t<P>) noexcept {}
+};
+template <class... Rs>
+struct thread_caching_traits
+    : std::bool_constant<(std::is_same_v<typename Rs::reflector_type,
+                                         thread_caching_reflector> ||
+                          ...)> {};
+
+// Marker reflection added by skills::cow.
+struct cow_reflector {
+  cow_reflector() = default;
+  template <class P>
+  constexpr explicit cow_reflector(std::in_place_type_t<P>) noexcept {}
+};
+template <class... Rs>
+struct cow_traits
+    : std::bool_constant<
+          (std::is_same_v<typename Rs::reflector_type, cow_reflector> || ...)> {
+};
+
+// A process-wide table of the metas of the types that a facade has been
+// instantiated with. Index 0 is reserved for "no value". Registering a type
+// beyond the capacity throws std::bad_alloc, and is retried on the next use.
+// find() looks a type up without registering it.
+template <class M, std::uint32_t Capacity>
+class compact_meta_registry {
 public:
-  template <class... Args>
-  explicit inplace_ptr(std::in_place_t, Args&&... args)
-      : value_(std::forward<Args>(args)...) {}
-  inplace_ptr() = default;
-  inplace_ptr(const inplace_ptr&) = default;
-  inplace_ptr(inplace_ptr&&) = default;
-  inplace_ptr& operator=(const inplace_ptr&) = default;
-  inplace_ptr& operator=(inplace_ptr&&) = default;
+  static constexpr std::uint32_t capacity = Capacity;
 
-  T* operator->() noexcept { return std::addressof(value_); }
-  const T* operator->() const noexcept { return std::addressof(value_); }
-  T& operator*() & noexcept { return value_; }
-  const T& operator*() const& noexcept { return value_; }
-  T&& operator*() && noexcept { return std::move(value_); }
-  const T&& operator*() const&& noexcept { return std::move(value_); }
+  template <class P>
+  static std::uint32_t index_of() {
+    static const std::uint32_t result = [] {
+      std::uint32_t index = size_.load(std::memory_order::relaxed);
+      do {
+        if (index >= capacity) {
+          // Too many distinct types for the facade
+          PRO4D_THROW(std::bad_alloc{});
+        }
+      } while (!size_.compare_exchange_weak(index, index + 1u,
+                                            std::memory_order::relaxed));
+      std::construct_at(reinterpret_cast<M*>(storage_) + index,
+                        std::in_place_type<P>);
+      indices_<P>.store(index, std::memory_order::release);
+      return index;
+    }();
+    return result;
+  }
+  // Returns 0 if P has not been registered.
+  template <class P>
+  static std::uint32_t find() noexcept {
+    return indices_<P>.load(std::memory_order::acquire);
+  }
+  static const M* get(std::uint32_t index) noexcept {
+    return std::launder(reinterpret_cast<const M*>(storage_) + index);
+  }
 
 private:
-  [[PROD_NO_UNIQUE_ADDRESS_ATTRIBUTE]]
-  T value_;
+  template <class P>
+  static inline std::atomic<std::uint32_t> indices_ = 0u;
+  static inline std::atomic<std::uint32_t> size_ = 1u;
+  alignas(M) static inline std::byte storage_[sizeof(M) * capacity];
 };
+template <class M>
+struct meta_ptr_indexed_impl {
+  using registry = compact_meta_registry<M, 1024u>;
 
-template <class F, bool IsDirect, class D, class O, class P, class... Args>
-decltype(auto) invoke_impl(P&& p, Args&&... args) {
-  auto dispatcher =
-      proxy_helper::get_meta(p)
-          .template invocation_meta<F, IsDirect, D, O>::dispatcher;
-  return dispatcher(std::forward<P>(p), std::forward<Args>(args)...);
-}
-template <class F, qualifier_type Q>
-add_qualifier_t<proxy<F>, Q>
-    as_proxy(add_qualifier_t<proxy_indirect_accessor<F>, Q> p) {
-  return static_cast<add_qualifier_t<proxy<F>, Q>>(
-      *reinterpret_cast<
-          add_qualifier_ptr_t<inplace_ptr<proxy_indirect_accessor<F>>, Q>>(
-          std::addressof(p)));
-}
+  meta_ptr_indexed_impl() = default;
+  template <class P>
+  explicit meta_ptr_indexed_impl(std::in_place_type_t<P>)
+      : index_(registry::template index_of<P>()) {}
+  bool has_value() const noexcept { return index_ != 0u; }
+  void reset() noexcept { index_ = 0u; }
+  const M* operator->() const noexcept { return registry::get(index_); }
+  template <class IM>
+  const IM& get() const noexcept {
+    return *operator->();
+  }
+  template <class P>
+  bool is_meta_of() const noexcept {
+    return index_ != 0u && index_ == registry::template find<P>();
+  }
+  friend bool operator==(const meta_ptr_indexed_impl&,
+                         const meta_ptr_indexed_impl&) noexcept = default;
 
-} // namespace details
+private:
+  std::uint32_t index_;
+};
+
+// Marker reflection added by skills::pooled_meta.
+struct pooled_meta_reflector {
+  pooled_meta_reflector() = default;
+  template <class P>
+  constexpr explicit pooled_meta_reflector(std::in_place_type_t<P>) noexcept {}
+};
+template <class... Rs>
+struct pooled_meta_traits
+    : std::bool_constant<
+          (std::is_same_v<typename Rs::reflector_type, pooled_meta_reflector> ||
+           ...)> {};
+
+// The alignment of a pooled meta: the smallest power of two that is not less
+// than its size, up to a cache line. A meta thus never straddles more cache
+// lines than necessary, while small metas are still packed together.
+template <class M>
+consteval std::size_t pooled_meta_alignment() {
+  constexpr std::size_t cache_line_size = 64u;
+  std::size_t result = alignof(M);
+  while (result < sizeof(M) && result < cache_line_size) {
+    result *= 2u;
+  }
+  return result;
+}
+
+// A process-wide pool of the metas of the types that a facade has been
+// instantiated with, laid out contiguously in the order of their first use.
+// Metas beyond the capacity fall back to static storage. find() looks a type up
+// without claiming a slot for it.
+template <class M, std::size_t Capacity>
+class pooled_meta_registry {
+  static constexpr std::size_t alignment = pooled_meta_alignment<M>();
+  static constexpr std::size_t slot_size =
+      (sizeof(M) + alignment - 1u) / alignment * alignment;
+
+public:
+  static constexpr std::size_t capacity = Capacity;
+
+  template <class P>
+  static const M* get() {
+    static const M* const result = [] {
+      std::size_t index = size_.fetch_add(1u, std::memory_order::relaxed);
+      const M* meta = &fallback<P>;
+      if (index < capacity) {
+        meta = std::construct_at(
+            reinterpret_cast<M*>(storage_ + index * slot_size),
+            std::in_place_type<P>);
+      }
+      metas_<P>.store(meta, std::memory_order::release);
+      return meta;
+    }();
+    return result;
+  }
+  // Returns nullptr if get<P>() has not been called.
+  template <class P>
+  static const M* find() noexcept {
+    return metas_<P>.load(std::memory_order::acquire);
+  }
+
+private:
+  template <class P>
+  static inline std::atomic<const M*> metas_ = nullptr;
+  template <class P>
+  static constexpr M fallback{std::in_place_type<P>};
+  static inline std::atomic<std::size_t> size_ = 0u;
+  alignas(alignment) static inline std::byte storage_[slot_size * capacity];
+};
+template <class M>
+struct meta_ptr_pooled_impl : meta_ptr_indirect_impl<M> {
+  using registry = pooled_meta_registry<M, 1024u>;
+
+  meta_ptr_pooled_impl() = default;
+  template <class P>
+  explicit meta_ptr_pooled_impl(std::in_place_type_t<P>)
+      : meta_ptr_indirect_impl<M>(registry::template get<P>()) {}
+  template <class P>
+  bool is_meta_of() const noexcept {
+    const M* meta = registry::template find<P>();
+    return meta != nullptr && meta == this->operator->();
+  }
+};
+
+// Packs the index of the meta into the low bits of the address of the
+// contained pointer, which is then stored in the same word.
+template <class M>
+struct meta_ptr_tagged_impl {
+  static constexpr std::uintptr_t tag_mask = alignof(std::uintptr_t) - 1u;
+  using registry = compact_meta_registry<M, tag_mask + 1u>;
+
+  meta_ptr_tagged_impl() = default;
+  template <class P>
+  explicit meta_ptr_tagged_impl(std::in_place_type_t<P>)
+      : word_(registry::template index_of<P>()) {}
+  bool has_value() const noexcept { return (word_ & tag_mask) != 0u; }
+  void reset() noexcept { word_ = 0u; }
+  const M* operator->() const noexcept {
+    return registry::get(static_cast<std::uint32_t>(word_ & tag_mask));
+  }
+  template <class IM>
+  const IM& get() const noexcept {
+    return *operator->();
+  }
+  template <class P>
+  bool is_meta_of() const noexcept {
+    std::uintptr_t tag = word_ & tag_mask;
+    return tag != 0u && tag == registry::template find<P>();
+  }
+  std::uintptr_t address() const noexcept { return word_ & ~tag_mask; }
+  void set_address(std::uintptr_t address) noexcept {
+    assert((address & tag_mask) == 0u);
+    word_ = address | (word_ & tag_mask);
+  }
+  friend bool operator==(const meta_ptr_tagged_impl& lhs,
+                         const meta_ptr_tagged_impl& rhs) noexcept {
+    return (lhs.word_ & tag_mask) == (rhs.word_ & tag_mask);
+  }
+
+private:
+  std::uintptr_t word_;
+};
+#endif // __STDC_HOSTED__
+
+// Marker reflection added by skills::stateless. Only empty pointers can be
+// materialized on demand instead of being stored in the proxy.
+template <class P>
+constexpr bool is_stateless_ptr =
+    std::is_empty_v<P> && std::is_trivially_copyable_v<P>;
+struct stateless_meta_reflector {
+  stateless_meta_reflector() = default;
+  template <class P>
+    requires(is_stateless_ptr<P>)
+  constexpr explicit stateless_meta_reflector(
+      std::in_place_type_t<P>) noexcept {}
+};
+template <class... Rs>
+struct stateless_meta_traits
+    : std::bool_constant<(std::is_same_v<typename Rs::reflector_type,
+                                         stateless_meta_reflector> ||
+                          ...)> {};
+
+// How a facade references a meta that is not embedded in the proxy.
+template <class M, bool IsPooled>
+struct out_of_line_meta_ptr_traits
+    : std::type_identity<meta_ptr_indirect_impl<M>> {};
+#if __STDC_HOSTED__
+template <class M>
+struct out_of_line_meta_ptr_traits<M, true>
+    : std::type_identity<meta_ptr_pooled_impl<M>> {};
+#endif // __STDC_HOSTED__
+template <class M, bool IsPooled>
+using out_of_line_meta_ptr =
+    typename out_of_line_meta_ptr_traits<M, IsPooled>::type;
+
+// The storage of the contained pointer when it is not stored in the proxy,
+// i.e., it lives in the meta word or is empty: an empty range, so that copying
+// or swapping it is a no-op.
+struct detached_ptr_storage {
+  std::byte* begin() const noexcept { return nullptr; }
+  std::byte* end() const noexcept { return nullptr; }
+};
+
+// Lifetime properties of the contained pointer type that let a proxy copy,
+// relocate or destroy it without calling the dispatchers of the lifetime
+// conventions.
+struct lifetime_flags_meta {
+  lifetime_flags_meta() = default;
+  template <class P>
+  constexpr explicit lifetime_flags_meta(std::in_place_type_t<P>) noexcept
+      : trivially_copyable(std::is_trivially_copyable_v<P>),
+        trivially_relocatable(is_bitwise_trivially_relocatable_v<P>),
+        trivially_destructible(std::is_trivially_destructible_v<P>) {}
+
+  bool trivially_copyable;
+  bool trivially_relocatable;
+  bool trivially_destructible;
+};
+consteval bool has_lifetime_dispatcher(constraint_level cl) {
+  return cl == constraint_level::nontrivial || cl == constraint_level::nothrow;
+}
+// The flags are only recorded in metas stored out of line, so that they never
+// grow a proxy.
+template <class F, class M, std::size_t MaxSize>
+using lifetime_flags_meta_t = std::conditional_t<
+    !is_direct_meta_ptr<meta_ptr<M, MaxSize>> &&
+        (has_lifetime_dispatcher(F::copyability) ||
+         has_lifetime_dispatcher(F::relocatability) ||
+         has_lifetime_dispatcher(F::destructibility)),
+    composite_t<M, lifetime_flags_meta>, M>;
+
+template <class F>
+struct facade_meta_ptr_traits {
+  static constexpr bool has_stateless_marker =
+      instantiated_t<stateless_meta_traits,
+                     typename F::reflection_types>::value;
+  // The meta of a stateless facade is embedded only if it fits in the single
+  // word of the proxy.
+  static constexpr std::size_t max_inline_meta_size =
+      has_stateless_marker
+          ? sizeof(void*)
+          : instantiated_t<inline_meta_size_traits,
+                           typename F::reflection_types>::value;
+  using hot_meta =
+      instantiated_t<hot_meta_t, typename F::reflection_types, F>;
+#if __STDC_HOSTED__
+  static constexpr bool has_indexed_meta =
+      instantiated_t<compact_meta_traits,
+                     typename F::reflection_types>::value ||
+      instantiated_t<tagged_meta_traits, typename F::reflection_types>::value;
+#else
+  static constexpr bool has_indexed_meta = false;
+#endif // __STDC_HOSTED__
+  // Referencing the shared invocation metas costs an indirection, so that they
+  // are only split out of metas that are stored out of line and not indexed.
+  // The rest is then embedded only if it fits in the pointer it replaces,
+  // unless more room is reserved with inline_meta.
+  static constexpr bool is_meta_shared =
+      has_shared_meta<F> && !has_indexed_meta &&
+      !is_direct_meta_ptr<
+          meta_ptr<typename facade_traits<F>::meta, max_inline_meta_size>>;
+  static constexpr std::size_t max_embedded_meta_size =
+      is_meta_shared &&
+              !instantiated_t<inline_meta_traits,
+                              typename F::reflection_types>::value
+          ? sizeof(void*)
+          : max_inline_meta_size;
+  using shared_meta_split =
+      shared_meta_split_traits<typename facade_traits<F>::meta, hot_meta>;
+  using shared_ref = typename shared_meta_split::shared_ref;
+  template <class IM>
+  static constexpr bool is_shared =
+      is_meta_shared && shared_invocation_traits<hot_meta, IM>::applicable;
+  template <class IM>
+  using shared_t = typename shared_invocation_traits<hot_meta, IM>::type;
+  using meta = lifetime_flags_meta_t<
+      F,
+      std::conditional_t<is_meta_shared, typename shared_meta_split::type,
+                         typename facade_traits<F>::meta>,
+      max_embedded_meta_size>;
+  static constexpr bool has_lifetime_flags =
+      std::is_base_of_v<lifetime_flags_meta, meta>;
+  using embedded_meta_ptr = meta_ptr<meta, max_embedded_meta_size>;
+#if __STDC_HOSTED__
+  static constexpr bool is_pooled =
+      instantiated_t<pooled_meta_traits, typename F::reflection_types>::value;
+#else
+  static constexpr bool is_pooled = false;
+#endif // __STDC_HOSTED__
+  using cold_meta = typename cold_meta_traits<meta, hot_meta>::type;
+  using pointer_meta_ptr = std::conditional_t<
+      is_direct_meta_ptr<embedded_meta_ptr>, embedded_meta_ptr,
+      std::conditional_t<
+          std::is_same_v<hot_meta, composite_meta<>>,
+          out_of_line_meta_ptr<meta, is_pooled>,
+          meta_ptr_split_impl<cold_meta, hot_meta,
+                              out_of_line_meta_ptr<cold_meta, is_pooled>>>>;
+#if __STDC_HOSTED__
+  static constexpr bool is_compact =
+      instantiated_t<compact_meta_traits, typename F::reflection_types>::value;
+  static constexpr bool is_tagged =
+      !is_compact &&
+      instantiated_t<tagged_meta_traits, typename F::reflection_types>::value;
+  static constexpr bool is_stateless =
+      !is_compact && !is_tagged && has_stateless_marker;
+  using type = std::conditional_t<
+      is_compact, meta_ptr_indexed_impl<meta>,
+      std::conditional_t<is_tagged, meta_ptr_tagged_impl<meta>,
+                         pointer_meta_ptr>>;
+  using storage =
+      std::conditional_t<is_tagged || is_stateless, detached_ptr_storage,
+                         std::byte[F::max_size]>;
+#else
+  static constexpr bool is_compact = false;
+  static constexpr bool is_tagged = false;
+  static constexpr bool is_stateless = has_stateless_marker;
+  using type = pointer_meta_ptr;
+  using storage = std::conditional_t<is_stateless, detached_ptr_storage,
+                                     std::byte[F::max_size]>;
+#endif // __STDC_HOSTED__
+};
+template <class F>
+using facade_ptr_storage = typename facade_meta_ptr_traits<F>::storage;
+
+template <class T>
+class inplace_ptr {
+public:
+  template <class... Args>
+  explicit inplace_ptr(std::in_place_t, Args&&... args)
+      : value_(std::forward<Args>(args)...) {}
+  inplace_ptr() = default;
+  inplace_ptr(const inplace_ptr&) = default;
+  inplace_ptr(inplace_ptr&&) = default;
+  inplace_ptr& operator=(const inplace_ptr&) = default;
+  inplace_ptr& operator=(inplace_ptr&&) = default;
+
+  T* operator->() noexcept { return std::addressof(value_); }
+  const T* operator->() const noexcept { return std::addressof(value_); }
+  T& operator*() & noexcept { return value_; }
+  const T& operator*() const& noexcept { return value_; }
+  T&& operator*() && noexcept { return std::move(value_); }
+  const T&& operator*() const&& noexcept { return std::move(value_); }
+
+private:
+  [[PROD_NO_UNIQUE_ADDRESS_ATTRIBUTE]]
+  T value_;
+};
+
+template <class F>
+struct speculation_traits;
+
+template <class F, bool IsDirect, class D, class O, class P, class... Args>
+decltype(auto) invoke_impl(P&& p, Args&&... args) {
+  if constexpr (speculation_traits<F>::applicable) {
+    return speculation_traits<F>::template invoke<IsDirect, D, O>(
+        std::forward<P>(p), std::forward<Args>(args)...);
+  } else {
+    auto dispatcher =
+        proxy_helper::get_invocation_meta<IsDirect, D, O>(p).dispatcher;
+    return dispatcher(
+        overload_traits<O>::template dispatcher_operand<F, IsDirect>(
+            std::forward<P>(p)),
+        std::forward<Args>(args)...);
+  }
+}
+template <class F, qualifier_type Q>
+add_qualifier_t<proxy<F>, Q>
+    as_proxy(add_qualifier_t<proxy_indirect_accessor<F>, Q> p) {
+  return static_cast<add_qualifier_t<proxy<F>, Q>>(
+      *reinterpret_cast<
+          add_qualifier_ptr_t<inplace_ptr<proxy_indirect_accessor<F>>, Q>>(
+          std::addressof(p)));
+}
+
+} // namespace details
 
 template <class P, class F>
 concept proxiable = facade<F> && details::facade_traits<F>::applicable &&
@@ -998,6 +2063,9 @@ public:
              F::destructibility >= constraint_level::nontrivial)
   {
     if (this != std::addressof(rhs)) [[likely]] {
+      if (invoke_same_type<details::assign_meta<F>>(rhs)) {
+        return *this;
+      }
       if constexpr (F::copyability == constraint_level::nothrow) {
         destroy();
         initialize(rhs);
@@ -1075,6 +2143,9 @@ public:
       std::swap(ptr_, rhs.ptr_);
 #endif // __INTEL_LLVM_COMPILER
     } else {
+      if (invoke_same_type<details::swap_meta<F>>(rhs)) {
+        return;
+      }
       if (meta_.has_value()) {
         if (rhs.meta_.has_value()) {
           proxy temp = std::move(*this);
@@ -1094,7 +2165,9 @@ public:
       F::destructibility >= constraint_level::nothrow)
     requires(details::ptr_traits<P>::applicable &&
              std::is_constructible_v<P, Args...> &&
-             F::destructibility >= constraint_level::nontrivial)
+             F::destructibility >= constraint_level::nontrivial &&
+             !details::facade_meta_ptr_traits<F>::is_tagged &&
+             !details::facade_meta_ptr_traits<F>::is_stateless)
   {
     reset();
     return initialize<P>(std::forward<Args>(args)...);
@@ -1105,7 +2178,9 @@ public:
       F::destructibility >= constraint_level::nothrow)
     requires(details::ptr_traits<P>::applicable &&
              std::is_constructible_v<P, std::initializer_list<U>&, Args...> &&
-             F::destructibility >= constraint_level::nontrivial)
+             F::destructibility >= constraint_level::nontrivial &&
+             !details::facade_meta_ptr_traits<F>::is_tagged &&
+             !details::facade_meta_ptr_traits<F>::is_stateless)
   {
     reset();
     return initialize<P>(il, std::forward<Args>(args)...);
@@ -1123,20 +2198,51 @@ private:
     PRO4D_DEBUG(std::ignore = &pro_symbol_guard;)
     meta_.reset();
   }
+  // Whether the meta of a proxy that contains a value records the flag.
+  template <bool details::lifetime_flags_meta::* Flag>
+  static bool has_lifetime_flag(const proxy& p) noexcept {
+    if constexpr (details::facade_meta_ptr_traits<F>::has_lifetime_flags) {
+      return p.meta_.template get<details::lifetime_flags_meta>().*Flag;
+    } else {
+      return false;
+    }
+  }
+  // Invokes the dispatcher of M if both proxies contain the same pointer type
+  // that supports it, and returns whether it was invoked.
+  template <class M, class R>
+  bool invoke_same_type(R& rhs) noexcept(
+      std::is_nothrow_invocable_v<typename M::dispatcher_type, proxy&, R&>) {
+    if constexpr (std::is_base_of_v<M, typename details::facade_traits<
+                                           F>::meta> &&
+                  !details::facade_meta_ptr_traits<F>::is_tagged &&
+                  !details::facade_meta_ptr_traits<F>::is_stateless) {
+      if (meta_.has_value() && meta_ == rhs.meta_) {
+        auto dispatcher = meta_.template get<M>().dispatcher;
+        if (dispatcher != nullptr) {
+          dispatcher(*this, rhs);
+          return true;
+        }
+      }
+    }
+    return false;
+  }
   void initialize(const proxy& rhs)
     requires(F::copyability != constraint_level::none)
   {
     PRO4D_DEBUG(std::ignore = &pro_symbol_guard;)
     if (rhs.meta_.has_value()) {
-      if constexpr (F::copyability == constraint_level::trivial) {
-        std::ranges::uninitialized_copy(rhs.ptr_, ptr_);
-        meta_ = rhs.meta_;
-      } else {
-        proxy_invoke<details::copy_dispatch,
-                     void(proxy&) const noexcept(
-                         F::copyability == constraint_level::nothrow)>(rhs,
-                                                                       *this);
+      if constexpr (F::copyability != constraint_level::trivial) {
+        if (!has_lifetime_flag<&details::lifetime_flags_meta::
+                                   trivially_copyable>(rhs)) {
+          proxy_invoke<details::copy_dispatch,
+                       void(proxy&) const noexcept(
+                           F::copyability == constraint_level::nothrow)>(
+              rhs, *this);
+          return;
+        }
       }
+      std::ranges::uninitialized_copy(rhs.ptr_, ptr_);
+      meta_ = rhs.meta_;
     } else {
       meta_.reset();
     }
@@ -1146,38 +2252,77 @@ private:
   {
     PRO4D_DEBUG(std::ignore = &pro_symbol_guard;)
     if (rhs.meta_.has_value()) {
-      if constexpr (F::relocatability == constraint_level::trivial) {
-        std::ranges::uninitialized_copy(rhs.ptr_, ptr_);
-        meta_ = rhs.meta_;
-        rhs.meta_.reset();
-      } else {
-        proxy_invoke<details::relocate_dispatch,
-                     void(proxy&) && noexcept(F::relocatability ==
-                                              constraint_level::nothrow)>(
-            std::move(rhs), *this);
+      if constexpr (F::relocatability != constraint_level::trivial) {
+        if (!has_lifetime_flag<&details::lifetime_flags_meta::
+                                   trivially_relocatable>(rhs)) {
+          proxy_invoke<details::relocate_dispatch,
+                       void(proxy&) && noexcept(F::relocatability ==
+                                                constraint_level::nothrow)>(
+              std::move(rhs), *this);
+          return;
+        }
       }
+      std::ranges::uninitialized_copy(rhs.ptr_, ptr_);
+      meta_ = rhs.meta_;
+      rhs.meta_.reset();
     } else {
       meta_.reset();
     }
   }
   template <class P, class... Args>
-  constexpr P& initialize(Args&&... args) {
+  constexpr decltype(auto) initialize(Args&&... args) {
     PRO4D_DEBUG(std::ignore = &pro_symbol_guard;)
-    P& result = *std::construct_at(reinterpret_cast<P*>(ptr_),
-                                   std::forward<Args>(args)...);
-    if constexpr (proxiable<P, F>) {
-      meta_ = details::meta_ptr<typename details::facade_traits<F>::meta>{
-          std::in_place_type<P>};
+    if constexpr (details::facade_meta_ptr_traits<F>::is_tagged) {
+      if constexpr (proxiable<P, F>) {
+        // Registering the type may throw, so it precedes the construction.
+        meta_ = details::facade_meta_ptr<F>{std::in_place_type<P>};
+        alignas(P) std::byte storage[sizeof(P)];
+        std::construct_at(reinterpret_cast<P*>(storage),
+                          std::forward<Args>(args)...);
+        meta_.set_address(std::bit_cast<std::uintptr_t>(storage));
+      } else {
+        details::facade_traits<F>::template diagnose_proxiable<P>();
+      }
+    } else if constexpr (details::facade_meta_ptr_traits<F>::is_stateless) {
+      if constexpr (proxiable<P, F>) {
+        // The pointer is empty and trivially destructible, so only the
+        // effects of its construction are kept.
+        alignas(P) std::byte storage[sizeof(P)];
+        std::construct_at(reinterpret_cast<P*>(storage),
+                          std::forward<Args>(args)...);
+        meta_ = details::facade_meta_ptr<F>{std::in_place_type<P>};
+      } else {
+        details::facade_traits<F>::template diagnose_proxiable<P>();
+      }
+    } else if constexpr (details::facade_meta_ptr_traits<F>::is_compact) {
+      if constexpr (proxiable<P, F>) {
+        // Registering the type may throw, so it precedes the construction.
+        details::facade_meta_ptr<F> meta{std::in_place_type<P>};
+        P& result = *std::construct_at(reinterpret_cast<P*>(ptr_),
+                                       std::forward<Args>(args)...);
+        meta_ = meta;
+        return result;
+      } else {
+        details::facade_traits<F>::template diagnose_proxiable<P>();
+      }
     } else {
-      details::facade_traits<F>::template diagnose_proxiable<P>();
+      P& result = *std::construct_at(reinterpret_cast<P*>(ptr_),
+                                     std::forward<Args>(args)...);
+      if constexpr (proxiable<P, F>) {
+        meta_ = details::facade_meta_ptr<F>{std::in_place_type<P>};
+      } else {
+        details::facade_traits<F>::template diagnose_proxiable<P>();
+      }
+      return result;
     }
-    return result;
   }
   void destroy()
     requires(F::destructibility != constraint_level::none)
   {
     if constexpr (F::destructibility != constraint_level::trivial) {
-      if (meta_.has_value()) {
+      if (meta_.has_value() &&
+          !has_lifetime_flag<&details::lifetime_flags_meta::
+                                 trivially_destructible>(*this)) {
         proxy_invoke<details::destroy_dispatch,
                      void() noexcept(F::destructibility ==
                                      constraint_level::nothrow)>(*this);
@@ -1194,8 +2339,9 @@ private:
     *std::move(cself);
   })
 
-  details::meta_ptr<typename details::facade_traits<F>::meta> meta_;
-  alignas(F::max_align) std::byte ptr_[F::max_size];
+  details::facade_meta_ptr<F> meta_;
+  [[PROD_NO_UNIQUE_ADDRESS_ATTRIBUTE]]
+  alignas(F::max_align) details::facade_ptr_storage<F> ptr_;
 };
 
 template <class D, class O, facade F, class... Args>
@@ -1263,6 +2409,310 @@ const R& proxy_reflect(const proxy<F>& p) noexcept {
       .reflector;
 }
 
+#if __STDC_HOSTED__
+// =============================================================================
+// == Batch Invocation (proxy_invoke_batch, proxy_batch)                      ==
+// =============================================================================
+
+template <facade F>
+class proxy_batch;
+
+namespace details {
+
+template <class C, class F>
+struct conv_batch_accessor_traits : std::type_identity<void> {};
+template <class C, class F>
+  requires(!C::is_direct && conv_traits<C, F>::is_batch_invocable)
+struct conv_batch_accessor_traits<C, F>
+    : std::type_identity<
+          typename conv_traits<C, F>::template accessor<proxy_batch<F>>> {};
+template <class C, class F>
+using conv_batch_accessor_t = typename conv_batch_accessor_traits<C, F>::type;
+
+template <class F, class... Cs>
+using batch_accessor_impl_t =
+    composite_t<composite_accessor<>, conv_batch_accessor_t<Cs, F>...>;
+template <class F>
+using batch_accessor_t =
+    instantiated_t<batch_accessor_impl_t, typename F::convention_types, F>;
+
+template <class F, class D, class O>
+constexpr bool is_batch_direct =
+    !facade_traits<F>::template is_invocable<false, D, O>;
+template <class O, bool IsConst, bool IsVoid>
+constexpr bool is_batch_applicable =
+    overload_traits<O>::template is_batch_applicable<IsConst> &&
+    std::is_void_v<typename overload_traits<O>::return_type> == IsVoid;
+
+// Invokes the convention on each element, loading the dispatcher only once per
+// run of consecutive elements that share the same meta. When the meta is
+// (partially) stored indirectly, a run is detected by comparing the meta
+// pointers, which saves the dependent load of the dispatcher. When it is stored
+// directly, the dispatcher is already embedded in the proxy and is compared
+// instead.
+template <class F, bool IsDirect, class D, class O, class T, class OutIt,
+          class... Args>
+OutIt invoke_batch_impl(std::span<T> proxies, OutIt out, Args&... args) {
+  auto it = proxies.begin();
+  const auto last = proxies.end();
+  while (it != last) {
+    T& head = *it;
+    const auto dispatcher =
+        proxy_helper::get_invocation_meta<IsDirect, D, O>(head).dispatcher;
+    do {
+      if constexpr (std::is_void_v<typename overload_traits<O>::return_type>) {
+        dispatcher(
+            overload_traits<O>::template dispatcher_operand<F, IsDirect>(*it),
+            args...);
+      } else {
+        *out = dispatcher(
+            overload_traits<O>::template dispatcher_operand<F, IsDirect>(*it),
+            args...);
+        ++out;
+      }
+      if (++it == last) {
+        break;
+      }
+      if constexpr (!is_direct_meta_ptr<facade_meta_ptr<F>>) {
+        if (!proxy_helper::is_same_meta(*it, head)) {
+          break;
+        }
+      } else if (proxy_helper::get_invocation_meta<IsDirect, D, O>(*it)
+                     .dispatcher != dispatcher) {
+        break;
+      }
+    } while (true);
+  }
+  return out;
+}
+
+} // namespace details
+
+template <class D, class O, facade F, class... Args>
+  requires(details::is_batch_applicable<O, false, true>)
+void proxy_invoke_batch(std::span<proxy<F>> proxies, Args&&... args) {
+  details::invoke_batch_impl<F, details::is_batch_direct<F, D, O>, D, O>(
+      proxies, nullptr, args...);
+}
+template <class D, class O, facade F, class... Args>
+  requires(details::is_batch_applicable<O, true, true>)
+void proxy_invoke_batch(std::span<const proxy<F>> proxies, Args&&... args) {
+  details::invoke_batch_impl<F, details::is_batch_direct<F, D, O>, D, O>(
+      proxies, nullptr, args...);
+}
+template <class D, class O, facade F, class OutIt, class... Args>
+  requires(details::is_batch_applicable<O, false, false>)
+OutIt proxy_invoke_batch(std::span<proxy<F>> proxies, OutIt out,
+                         Args&&... args) {
+  return details::invoke_batch_impl<F, details::is_batch_direct<F, D, O>, D,
+                                    O>(proxies, std::move(out), args...);
+}
+template <class D, class O, facade F, class OutIt, class... Args>
+  requires(details::is_batch_applicable<O, true, false>)
+OutIt proxy_invoke_batch(std::span<const proxy<F>> proxies, OutIt out,
+                         Args&&... args) {
+  return details::invoke_batch_impl<F, details::is_batch_direct<F, D, O>, D,
+                                    O>(proxies, std::move(out), args...);
+}
+
+template <facade F>
+class proxy_batch : public details::batch_accessor_t<F> {
+  friend struct details::proxy_helper;
+
+public:
+  explicit proxy_batch(std::span<proxy<F>> proxies) noexcept
+      : proxies_(proxies) {}
+  proxy_batch(const proxy_batch&) noexcept = default;
+  proxy_batch& operator=(const proxy_batch&) noexcept = default;
+
+private:
+  std::span<proxy<F>> proxies_;
+};
+
+template <class D, class O, facade F, class... Args>
+void proxy_invoke(proxy_batch<F>& b, Args&&... args) {
+  proxy_invoke_batch<D, O>(details::proxy_helper::get_proxies(b),
+                           std::forward<Args>(args)...);
+}
+template <class D, class O, facade F, class... Args>
+void proxy_invoke(const proxy_batch<F>& b, Args&&... args) {
+  proxy_invoke_batch<D, O>(
+      std::span<const proxy<F>>{details::proxy_helper::get_proxies(b)},
+      std::forward<Args>(args)...);
+}
+#endif // __STDC_HOSTED__
+
+#if __STDC_HOSTED__
+// =============================================================================
+// == Bulk Lifetime (uninitialized_relocate_n, uninitialized_copy_n, etc.)    ==
+// =============================================================================
+
+namespace details {
+
+template <class D, constraint_level C, class ONE, class OE,
+          bool lifetime_flags_meta::* Flag>
+struct lifetime_dispatch_traits {
+  using dispatch_type = D;
+  using overload_type = std::conditional_t<C == constraint_level::nothrow,
+                                           ONE, OE>;
+  static constexpr bool lifetime_flags_meta::* flag = Flag;
+};
+template <class F>
+using copy_dispatch_traits =
+    lifetime_dispatch_traits<copy_dispatch, F::copyability,
+                             void(proxy<F>&) const noexcept,
+                             void(proxy<F>&) const,
+                             &lifetime_flags_meta::trivially_copyable>;
+template <class F>
+using relocate_dispatch_traits =
+    lifetime_dispatch_traits<relocate_dispatch, F::relocatability,
+                             void(proxy<F>&) && noexcept, void(proxy<F>&) &&,
+                             &lifetime_flags_meta::trivially_relocatable>;
+template <class F>
+using destroy_dispatch_traits =
+    lifetime_dispatch_traits<destroy_dispatch, F::destructibility,
+                             void() noexcept, void(),
+                             &lifetime_flags_meta::trivially_destructible>;
+
+// Converts an element to the first argument of the dispatcher of the lifetime
+// convention, which may not be the proxy itself (see skills::shared_meta).
+template <class Traits, class F, class P>
+decltype(auto) lifetime_operand(P&& p) noexcept {
+  return overload_traits<typename Traits::overload_type>::
+      template dispatcher_operand<F, true>(std::forward<P>(p));
+}
+
+// Calls `fn(i, dispatcher)` for each element, loading the dispatcher of the
+// lifetime convention only once per run of consecutive elements that share the
+// same meta, like invoke_batch_impl. `dispatcher` is null for empty elements,
+// and for elements whose meta records that the operation is trivial for their
+// pointer type. `fn` may leave the element empty.
+template <class Traits, class F, class Fn>
+void for_each_lifetime_run(const proxy<F>* first, std::size_t count, Fn&& fn) {
+  using D = typename Traits::dispatch_type;
+  using O = typename Traits::overload_type;
+  using dispatcher_type =
+      typename overload_traits<O>::template dispatcher_type<F, true>;
+  std::size_t i = 0u;
+  while (i < count) {
+    if (!first[i].has_value()) {
+      fn(i++, dispatcher_type{});
+      continue;
+    }
+    const facade_meta_ptr<F> meta = proxy_helper::get_meta_ptr(first[i]);
+    const dispatcher_type dispatcher =
+        proxy_helper::has_lifetime_flag<Traits::flag>(first[i])
+            ? dispatcher_type{}
+            : proxy_helper::get_invocation_meta<true, D, O>(first[i])
+                  .dispatcher;
+    do {
+      fn(i, dispatcher);
+      if (++i == count || !first[i].has_value()) {
+        break;
+      }
+      if constexpr (!is_direct_meta_ptr<facade_meta_ptr<F>>) {
+        if (!(proxy_helper::get_meta_ptr(first[i]) == meta)) {
+          break;
+        }
+      } else if (proxy_helper::get_invocation_meta<true, D, O>(first[i])
+                     .dispatcher != dispatcher) {
+        break;
+      }
+    } while (true);
+  }
+}
+
+} // namespace details
+
+template <facade F>
+  requires(F::relocatability != constraint_level::none)
+proxy<F>* uninitialized_relocate_n(proxy<F>* first, std::size_t count,
+                                   proxy<F>* d_first) noexcept(
+    F::relocatability >= constraint_level::nothrow) {
+  if constexpr (F::relocatability == constraint_level::trivial) {
+    // An empty range may be null, e.g., the storage of an empty proxy_vector
+    if (count != 0u) {
+      std::memcpy(static_cast<void*>(d_first), static_cast<void*>(first),
+                  count * sizeof(proxy<F>));
+    }
+  } else {
+    std::size_t done = 0u;
+    // If relocating an element throws, the element has been destroyed, and
+    // both ranges are destroyed as well.
+    auto rollback = [&](proxy<F>*) {
+      std::destroy_n(d_first, done);
+      std::destroy(first + done + 1u, first + count);
+    };
+    std::unique_ptr<proxy<F>, decltype(rollback)> guard{d_first, rollback};
+    details::for_each_lifetime_run<details::relocate_dispatch_traits<F>>(
+        first, count, [&](std::size_t i, auto dispatcher) {
+          if (dispatcher == nullptr) {
+            // Empty, or bitwise trivially relocatable like the whole range
+            // of a trivial facade
+            std::memcpy(static_cast<void*>(d_first + i),
+                        static_cast<void*>(first + i), sizeof(proxy<F>));
+          } else {
+            dispatcher(std::move(first[i]), d_first[i]);
+          }
+          ++done;
+        });
+    guard.release();
+  }
+  return d_first + count;
+}
+
+template <facade F>
+  requires(F::copyability != constraint_level::none)
+proxy<F>* uninitialized_copy_n(const proxy<F>* first, std::size_t count,
+                               proxy<F>* d_first) noexcept(
+    F::copyability >= constraint_level::nothrow) {
+  if constexpr (F::copyability == constraint_level::trivial) {
+    if (count != 0u) {
+      std::memcpy(static_cast<void*>(d_first), static_cast<const void*>(first),
+                  count * sizeof(proxy<F>));
+    }
+  } else {
+    std::size_t done = 0u;
+    auto rollback = [&](proxy<F>*) { std::destroy_n(d_first, done); };
+    std::unique_ptr<proxy<F>, decltype(rollback)> guard{d_first, rollback};
+    details::for_each_lifetime_run<details::copy_dispatch_traits<F>>(
+        first, count, [&](std::size_t i, auto dispatcher) {
+          if (dispatcher == nullptr) {
+            // Empty, or trivially copyable like the whole range of a trivial
+            // facade
+            std::memcpy(static_cast<void*>(d_first + i),
+                        static_cast<const void*>(first + i), sizeof(proxy<F>));
+          } else {
+            dispatcher(
+                details::lifetime_operand<details::copy_dispatch_traits<F>, F>(
+                    first[i]),
+                d_first[i]);
+          }
+          ++done;
+        });
+    guard.release();
+  }
+  return d_first + count;
+}
+
+template <facade F>
+  requires(F::destructibility != constraint_level::none)
+proxy<F>* destroy_n(proxy<F>* first, std::size_t count) noexcept(
+    F::destructibility >= constraint_level::nothrow) {
+  if constexpr (F::destructibility != constraint_level::trivial) {
+    details::for_each_lifetime_run<details::destroy_dispatch_traits<F>>(
+        first, count, [&](std::size_t i, auto dispatcher) {
+          if (dispatcher != nullptr) {
+            dispatcher(
+                details::lifetime_operand<details::destroy_dispatch_traits<F>,
+                                          F>(first[i]));
+          }
+        });
+  }
+  return first + count;
+}
+#endif // __STDC_HOSTED__
+
 // =============================================================================
 // == Core Extensions (substitution_dispatch, proxy_view, weak_proxy)         ==
 // =============================================================================
@@ -1385,9 +2835,14 @@ struct observer_conv_traits<C> : std::type_identity<C> {};
 template <class... Cs>
 using observer_conv_types =
     composite_t<std::tuple<>, typename observer_conv_traits<Cs>::type...>;
+// The register calling convention is kept for views of facades that opted in,
+// since the contained pointer of a view is always passable in a register.
 template <class... Rs>
-using observer_refl_types =
-    composite_t<std::tuple<>, std::conditional_t<Rs::is_direct, void, Rs>...>;
+using observer_refl_types = composite_t<
+    std::conditional_t<register_dispatch_traits<Rs...>::value,
+                       std::tuple<refl_impl<true, register_dispatch_reflector>>,
+                       std::tuple<>>,
+    std::conditional_t<Rs::is_direct, void, Rs>...>;
 
 template <class P>
 auto weak_lock_impl(const P& self) noexcept
@@ -1405,6 +2860,27 @@ auto weak_lock_impl(const P& self) noexcept
 }
 PRO4_DEF_FREE_AS_MEM_DISPATCH(weak_mem_lock, weak_lock_impl, lock);
 
+template <class F>
+class weak_borrow_callback;
+template <class P, class F>
+bool weak_with_locked_impl(const P& self, weak_borrow_callback<F> fn)
+  requires(requires { self.template with_locked<F>(fn); } ||
+           requires { bool(self.lock()); })
+{
+  if constexpr (requires { self.template with_locked<F>(fn); }) {
+    return self.template with_locked<F>(fn);
+  } else {
+    auto strong = self.lock();
+    if (!strong) {
+      return false;
+    }
+    fn(*strong);
+    return true;
+  }
+}
+PRO4_DEF_FREE_AS_MEM_DISPATCH(weak_mem_with_locked, weak_with_locked_impl,
+                              with_locked);
+
 template <class O>
 struct weak_substitution_overload_traits;
 #define PROD_DEF_WEAK_SUBSTITUTION_OVERLOAD_TRAITS(oq, pq, ne, ...)            \
@@ -1429,7 +2905,9 @@ struct weak_conv_traits<C>
 };
 template <class F, class... Cs>
 using weak_conv_types = composite_t<
-    std::tuple<conv_impl<true, weak_mem_lock, proxy<F>() const noexcept>>,
+    std::tuple<conv_impl<true, weak_mem_lock, proxy<F>() const noexcept>,
+               conv_impl<true, weak_mem_with_locked,
+                         bool(weak_borrow_callback<F>) const>>,
     typename weak_conv_traits<Cs>::type...>;
 
 } // namespace details
@@ -1507,6 +2985,30 @@ private:
   LR lr_;
 };
 
+// Invokes a callable with a proxy_view<F>, without owning the callable.
+template <class F>
+class weak_borrow_callback {
+public:
+  template <class Fn>
+  weak_borrow_callback(Fn&& fn) noexcept
+    requires(std::is_invocable_v<Fn&, proxy_view<F>>)
+      : fn_(std::addressof(fn)), invoke_([](void* fn, proxy_view<F> view) {
+          (*static_cast<std::remove_reference_t<Fn>*>(fn))(std::move(view));
+        }) {}
+
+  template <class T>
+  void operator()(T& value) const {
+    invoke_(fn_,
+            proxy_view<F>{std::in_place_type<observer_ptr<
+                              T&, const T&, T&&, const T&&>>,
+                          value});
+  }
+
+private:
+  void* fn_;
+  void (*invoke_)(void*, proxy_view<F>);
+};
+
 #if __STDC_HOSTED__
 template <class T, class Alloc, class... Args>
 T* allocate(const Alloc& alloc, Args&&... args) {
@@ -1524,14 +3026,186 @@ void deallocate(const Alloc& alloc, T* ptr) {
   std::destroy_at(ptr);
   al.deallocate(ptr, 1);
 }
-template <class Alloc>
-struct alloc_aware {
-  explicit alloc_aware(const Alloc& alloc) noexcept : alloc(alloc) {}
-  alloc_aware(const alloc_aware&) noexcept = default;
 
-  [[PROD_NO_UNIQUE_ADDRESS_ATTRIBUTE]]
-  Alloc alloc;
-};
+class spin_mutex {
+public:
+  void lock() noexcept {
+    while (flag_.test_and_set(std::memory_order::acquire)) {
+      flag_.wait(true, std::memory_order::relaxed);
+    }
+  }
+  void unlock() noexcept {
+    flag_.clear(std::memory_order::release);
+    flag_.notify_one();
+  }
+
+private:
+  std::atomic_flag flag_;
+};
+
+struct size_class_block {
+  size_class_block* next;
+  size_class_block* next_batch;
+};
+// A process-wide stack of batches of free blocks of the same size, linked
+// through the first block of each. New batches are carved out of slabs
+// obtained from operator new, and memory is never returned to the system.
+class size_class_pool {
+public:
+  void push(size_class_block* batch) noexcept {
+    mutex_.lock();
+    batch->next_batch = batches_;
+    batches_ = batch;
+    mutex_.unlock();
+  }
+  size_class_block* pop(std::size_t block_size, std::size_t batch_size) {
+    mutex_.lock();
+    size_class_block* result = batches_;
+    if (result != nullptr) {
+      batches_ = result->next_batch;
+    }
+    mutex_.unlock();
+    if (result == nullptr) {
+      auto* slab =
+          static_cast<std::byte*>(::operator new(block_size * batch_size));
+      for (std::size_t i = batch_size; i > 0u; --i) {
+        result = ::new (slab + (i - 1u) * block_size)
+            size_class_block{result, nullptr};
+      }
+    }
+    return result;
+  }
+
+private:
+  spin_mutex mutex_;
+  size_class_block* batches_ = nullptr;
+};
+// Objects of up to max_block_size bytes are allocated in power-of-two size
+// classes. Each thread keeps a free list for each class and exchanges blocks
+// with a size_class_pool in batches of batch_size, so that objects churned
+// through make_proxy are recycled without synchronization most of the time.
+// A batch returned by an exiting thread may be shorter than batch_size, so the
+// number of blocks a thread caches is only an estimate that decides when to
+// return a batch to the pool.
+class thread_cache {
+public:
+  static constexpr std::size_t min_block_size =
+      __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+  static constexpr std::size_t class_count = 8u;
+  static constexpr std::size_t max_block_size = min_block_size
+                                                << (class_count - 1u);
+  static constexpr std::size_t batch_size = 256u;
+
+  thread_cache() = default;
+  thread_cache(const thread_cache&) = delete;
+  ~thread_cache() {
+    destroyed_ = true;
+    for (std::size_t i = 0; i < class_count; ++i) {
+      if (heads_[i] != nullptr) {
+        pools_[i].push(heads_[i]);
+      }
+    }
+  }
+
+  static void* allocate(std::size_t size) {
+    std::size_t index = class_of(size);
+    if (index >= class_count) {
+      return ::operator new(size);
+    }
+    if (destroyed_) [[unlikely]] {
+      size_class_block* batch = pools_[index].pop(min_block_size << index, 1u);
+      if (batch->next != nullptr) {
+        pools_[index].push(batch->next);
+      }
+      return batch;
+    }
+    thread_cache& cache = instance();
+    size_class_block* result = cache.heads_[index];
+    if (result == nullptr) [[unlikely]] {
+      result = pools_[index].pop(min_block_size << index, batch_size);
+      cache.counts_[index] = batch_size;
+    }
+    cache.heads_[index] = result->next;
+    --cache.counts_[index];
+    return result;
+  }
+  static void deallocate(void* p, std::size_t size) noexcept {
+    std::size_t index = class_of(size);
+    if (index >= class_count) {
+      ::operator delete(p);
+      return;
+    }
+    if (destroyed_) [[unlikely]] {
+      pools_[index].push(::new (p) size_class_block{nullptr, nullptr});
+      return;
+    }
+    thread_cache& cache = instance();
+    cache.heads_[index] =
+        ::new (p) size_class_block{cache.heads_[index], nullptr};
+    if (++cache.counts_[index] >= 2u * batch_size) [[unlikely]] {
+      size_class_block* tail = cache.heads_[index];
+      std::size_t n = 1u;
+      for (; n < batch_size && tail->next != nullptr; ++n) {
+        tail = tail->next;
+      }
+      pools_[index].push(std::exchange(cache.heads_[index], tail->next));
+      tail->next = nullptr;
+      cache.counts_[index] -= n;
+    }
+  }
+
+private:
+  static thread_cache& instance() noexcept {
+    static thread_local thread_cache result;
+    return result;
+  }
+  static std::size_t class_of(std::size_t size) noexcept {
+    return static_cast<std::size_t>(
+        std::bit_width((size - 1u) / min_block_size));
+  }
+
+  size_class_block* heads_[class_count] = {};
+  std::size_t counts_[class_count] = {};
+
+  static inline size_class_pool pools_[class_count];
+  static inline thread_local bool destroyed_ = false;
+};
+template <class T>
+struct thread_caching_allocator {
+  using value_type = T;
+
+  thread_caching_allocator() = default;
+  template <class U>
+  constexpr thread_caching_allocator(
+      const thread_caching_allocator<U>&) noexcept {}
+
+  T* allocate(std::size_t n) {
+    if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+      return std::allocator<T>{}.allocate(n);
+    } else {
+      return static_cast<T*>(thread_cache::allocate(sizeof(T) * n));
+    }
+  }
+  void deallocate(T* p, std::size_t n) noexcept {
+    if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+      std::allocator<T>{}.deallocate(p, n);
+    } else {
+      thread_cache::deallocate(p, sizeof(T) * n);
+    }
+  }
+
+  friend bool operator==(const thread_caching_allocator&,
+                         const thread_caching_allocator&) noexcept = default;
+};
+
+template <class Alloc>
+struct alloc_aware {
+  explicit alloc_aware(const Alloc& alloc) noexcept : alloc(alloc) {}
+  alloc_aware(const alloc_aware&) noexcept = default;
+
+  [[PROD_NO_UNIQUE_ADDRESS_ATTRIBUTE]]
+  Alloc alloc;
+};
 template <class T>
 class indirect_ptr {
 public:
@@ -1557,16 +3231,29 @@ public:
   allocated_ptr(const Alloc& alloc, Args&&... args)
       : alloc_aware<Alloc>(alloc),
         indirect_ptr<inplace_ptr<T>>(allocate<inplace_ptr<T>>(
-            this->alloc, std::in_place, std::forward<Args>(args)...)) {}
+            alloc, std::in_place, std::forward<Args>(args)...)) {}
   allocated_ptr(const allocated_ptr& rhs)
     requires(std::is_copy_constructible_v<T>)
       : alloc_aware<Alloc>(rhs),
         indirect_ptr<inplace_ptr<T>>(
-            allocate<inplace_ptr<T>>(this->alloc, std::in_place, *rhs)) {}
+            allocate<inplace_ptr<T>>(rhs.alloc, std::in_place, *rhs)) {}
   allocated_ptr(allocated_ptr&& rhs) = delete;
   ~allocated_ptr() noexcept(std::is_nothrow_destructible_v<T>) {
     deallocate(this->alloc, this->ptr_);
   }
+  allocated_ptr& operator=(const allocated_ptr& rhs)
+    requires(std::is_copy_assignable_v<T>)
+  {
+    **this = *rhs;
+    return *this;
+  }
+
+  friend void swap(allocated_ptr& lhs, allocated_ptr& rhs) noexcept(
+      std::is_nothrow_swappable_v<Alloc>) {
+    using std::swap;
+    swap(lhs.alloc, rhs.alloc);
+    swap(lhs.ptr_, rhs.ptr_);
+  }
 };
 
 template <class T, class Alloc>
@@ -1594,14 +3281,646 @@ public:
   ~compact_ptr() noexcept(std::is_nothrow_destructible_v<T>) {
     deallocate(this->ptr_->alloc, this->ptr_);
   }
+  compact_ptr& operator=(const compact_ptr& rhs)
+    requires(std::is_copy_assignable_v<T>)
+  {
+    **this = *rhs;
+    return *this;
+  }
+
+  friend void swap(compact_ptr& lhs, compact_ptr& rhs) noexcept {
+    std::swap(lhs.ptr_, rhs.ptr_);
+  }
+};
+
+// Reference counts of shared_compact_ptr and strong_compact_ptr start at one.
+// release() returns whether the caller has released the last reference and
+// shall reclaim the storage. A count that lets another thread finish the
+// release calls `reclaim(this)` on that thread instead; the count is the first
+// member of a standard-layout base of the storage.
+using ref_count_reclaimer = void (*)(void*);
+
+class atomic_ref_count {
+public:
+  using weak_count_type = atomic_ref_count;
+
+  atomic_ref_count() = default;
+  atomic_ref_count(const atomic_ref_count&) = delete;
+
+  void acquire() noexcept { value_.fetch_add(1, std::memory_order::relaxed); }
+  bool try_acquire() noexcept {
+    long value = value_.load(std::memory_order::relaxed);
+    do {
+      if (value == 0) {
+        return false;
+      }
+    } while (!value_.compare_exchange_weak(value, value + 1,
+                                           std::memory_order::relaxed));
+    return true;
+  }
+  bool release(ref_count_reclaimer = nullptr) noexcept {
+    return value_.fetch_sub(1, std::memory_order::acq_rel) == 1;
+  }
+  bool expired() const noexcept {
+    return value_.load(std::memory_order::acquire) == 0;
+  }
+  bool unique() const noexcept {
+    return value_.load(std::memory_order::acquire) == 1;
+  }
+
+private:
+  std::atomic_long value_ = 1;
+};
+
+// Reference count of values that are only shared within one thread. In debug
+// builds, every access asserts that it happens on the thread that created the
+// count.
+class local_ref_count {
+public:
+  using weak_count_type = local_ref_count;
+
+  local_ref_count() noexcept { PRO4D_DEBUG(owner_ = current_thread();) }
+  local_ref_count(const local_ref_count&) = delete;
+
+  void acquire() noexcept {
+    check_owner();
+    ++value_;
+  }
+  bool try_acquire() noexcept {
+    check_owner();
+    if (value_ == 0) {
+      return false;
+    }
+    ++value_;
+    return true;
+  }
+  bool release(ref_count_reclaimer = nullptr) noexcept {
+    check_owner();
+    return --value_ == 0;
+  }
+  bool expired() const noexcept {
+    check_owner();
+    return value_ == 0;
+  }
+
+private:
+  static const void* current_thread() noexcept {
+    static thread_local const char tag{};
+    return &tag;
+  }
+  void check_owner() const noexcept {
+    PRO4D_DEBUG(assert(owner_ == current_thread());)
+  }
+
+  long value_ = 1;
+  // Only recorded in debug builds, but present in all of them, so that the
+  // layout of the blocks does not depend on NDEBUG
+  [[maybe_unused]] const void* owner_ = nullptr;
+};
+
+class biased_ref_count;
+// The state of a thread that owns biased_ref_count objects: the counts that
+// other threads have queued for merging. When a thread exits, it merges its
+// queue and detaches its record, which is reused by the next thread that needs
+// one, together with the ownership of the counts that are not yet merged.
+// Records are never freed.
+class biased_ref_owner {
+  friend class biased_ref_count;
+
+public:
+  biased_ref_owner() = default;
+  biased_ref_owner(const biased_ref_owner&) = delete;
+
+private:
+  struct binding {
+    binding() noexcept {
+      free_mutex_.lock();
+      biased_ref_owner* record = free_;
+      if (record != nullptr) {
+        free_ = record->next_free_;
+      }
+      free_mutex_.unlock();
+      if (record == nullptr) {
+        record = new (std::nothrow) biased_ref_owner();
+        if (record == nullptr) {
+          return;
+        }
+      }
+      record->mutex_.lock();
+      record->attached_ = true;
+      record->mutex_.unlock();
+      current_ = record;
+    }
+    ~binding() {
+      exited_ = true;
+      biased_ref_owner* record = std::exchange(current_, nullptr);
+      if (record == nullptr) {
+        return;
+      }
+      for (;;) {
+        record->mutex_.lock();
+        biased_ref_count* queue = record->take_queue();
+        if (queue == nullptr) {
+          record->attached_ = false;
+          record->mutex_.unlock();
+          break;
+        }
+        record->mutex_.unlock();
+        merge_all(queue);
+      }
+      free_mutex_.lock();
+      record->next_free_ = free_;
+      free_ = record;
+      free_mutex_.unlock();
+    }
+  };
+
+  static biased_ref_owner* current() noexcept {
+    if (current_ == nullptr && !exited_) [[unlikely]] {
+      static thread_local binding instance;
+    }
+    return current_;
+  }
+  bool has_queue() const noexcept {
+    return has_queue_.load(std::memory_order::relaxed);
+  }
+  biased_ref_count* take_queue() noexcept {
+    has_queue_.store(false, std::memory_order::relaxed);
+    return std::exchange(queue_, nullptr);
+  }
+  void merge_queue() noexcept {
+    mutex_.lock();
+    biased_ref_count* queue = take_queue();
+    mutex_.unlock();
+    merge_all(queue);
+  }
+  static void merge_all(biased_ref_count* queue) noexcept;
+  // Returns whether the caller shall reclaim `rc` because it was merged on
+  // behalf of a detached record.
+  bool enqueue(biased_ref_count* rc) noexcept;
+
+  spin_mutex mutex_;
+  bool attached_ = false;
+  biased_ref_count* queue_ = nullptr;
+  std::atomic_bool has_queue_ = false;
+  biased_ref_owner* next_free_ = nullptr;
+
+  static inline spin_mutex free_mutex_;
+  static inline biased_ref_owner* free_ = nullptr;
+  static inline thread_local biased_ref_owner* current_ = nullptr;
+  static inline thread_local bool exited_ = false;
+};
+// Biased reference counting: the thread that creates a count (its owner)
+// updates a plain counter, and other threads update an atomic one that holds
+// a "merged" flag, a "queued" flag and a signed number of references. When the
+// plain counter drops to zero, the owner merges it into the atomic one, and
+// all threads use the latter from then on. When a reference acquired by the
+// owner is released by another thread, the atomic number may become negative;
+// the count is then queued to its owner, which merges it the next time it
+// releases a reference to the same value or creates a count, or when it
+// exits, so that values handed off to another thread are reclaimed even if
+// the owner never touches them again. Counts created by an exiting thread
+// start merged.
+class biased_ref_count {
+  friend class biased_ref_owner;
+
+public:
+  using weak_count_type = atomic_ref_count;
+
+  biased_ref_count() noexcept : owner_(biased_ref_owner::current()) {
+    if (owner_ == nullptr) [[unlikely]] {
+      biased_ = 0;
+      shared_.store(unit | merged, std::memory_order::relaxed);
+    } else if (owner_->has_queue()) [[unlikely]] {
+      owner_->merge_queue();
+    }
+  }
+  biased_ref_count(const biased_ref_count&) = delete;
+
+  void acquire() noexcept {
+    if (owned()) {
+      ++biased_;
+    } else {
+      shared_.fetch_add(unit, std::memory_order::relaxed);
+    }
+  }
+  bool try_acquire() noexcept {
+    if (owned()) {
+      ++biased_;
+      return true;
+    }
+    long value = shared_.load(std::memory_order::relaxed);
+    do {
+      if ((value & merged) != 0 && value < unit) {
+        return false;
+      }
+    } while (!shared_.compare_exchange_weak(value, value + unit,
+                                            std::memory_order::relaxed));
+    return true;
+  }
+  bool release(ref_count_reclaimer reclaim) noexcept {
+    if (owned()) {
+      if (--biased_ != 0) {
+        if ((shared_.load(std::memory_order::relaxed) & queued) != 0)
+            [[unlikely]] {
+          owner_->merge_queue();
+        }
+        return false;
+      }
+      long value = shared_.fetch_or(merged, std::memory_order::acq_rel);
+      if ((value & queued) != 0) [[unlikely]] {
+        owner_->merge_queue();
+        return false;
+      }
+      return value < unit;
+    }
+    // The queued flag keeps the storage alive until the owner merges it, so it
+    // has to be set by the same operation that releases the reference.
+    long value = shared_.load(std::memory_order::relaxed), desired;
+    do {
+      desired = value - unit;
+      if ((desired & (merged | queued)) == 0 && desired < 0) {
+        desired |= queued;
+      }
+    } while (!shared_.compare_exchange_weak(value, desired,
+                                            std::memory_order::acq_rel));
+    if ((desired & queued) != 0 && (value & queued) == 0) [[unlikely]] {
+      reclaim_ = reclaim;
+      return owner_->enqueue(this);
+    }
+    return desired == merged;
+  }
+  bool expired() const noexcept {
+    if (owned()) {
+      return false;
+    }
+    long value = shared_.load(std::memory_order::acquire);
+    return (value & merged) != 0 && value < unit;
+  }
+
+private:
+  static constexpr long merged = 1, queued = 2, unit = 4;
+
+  bool owned() const noexcept {
+    return owner_ == biased_ref_owner::current_ && biased_ != 0;
+  }
+  // Called on the owner thread, or with the mutex of a detached owner held.
+  // Returns whether the last reference has been released.
+  bool merge() noexcept {
+    long delta = std::exchange(biased_, 0) * unit;
+    if (delta != 0) {
+      delta += merged;
+    }
+    delta -= queued;
+    return shared_.fetch_add(delta, std::memory_order::acq_rel) + delta ==
+           merged;
+  }
+
+  biased_ref_owner* const owner_;
+  long biased_ = 1;
+  std::atomic_long shared_ = 0;
+  biased_ref_count* next_ = nullptr;
+  ref_count_reclaimer reclaim_ = nullptr;
+};
+inline void biased_ref_owner::merge_all(biased_ref_count* queue) noexcept {
+  while (queue != nullptr) {
+    biased_ref_count* rc = std::exchange(queue, queue->next_);
+    if (rc->merge()) {
+      rc->reclaim_(rc);
+    }
+  }
+}
+inline bool biased_ref_owner::enqueue(biased_ref_count* rc) noexcept {
+  mutex_.lock();
+  if (!attached_) {
+    bool result = rc->merge();
+    mutex_.unlock();
+    return result;
+  }
+  rc->next_ = queue_;
+  queue_ = rc;
+  has_queue_.store(true, std::memory_order::relaxed);
+  mutex_.unlock();
+  return false;
+}
+
+// A block whose reclamation is deferred by epoch_domain. `reclaim` is called
+// with the address of the block, which is the first member of a
+// standard-layout object known to the callee.
+struct retired_block {
+  retired_block* next;
+  std::uint64_t epoch;
+  ref_count_reclaimer reclaim;
+};
+// Epoch-based reclamation. Threads read shared data inside an epoch_guard,
+// which publishes the global epoch observed on entry. A block retired at epoch
+// e is reclaimed by reclaim() once the global epoch has reached e + 2; the
+// epoch only advances when every thread inside a guard has observed the
+// current one, so no guard that could have reached the block is still active.
+// Retired blocks are pushed to a process-wide lock-free list. Participant
+// records of exited threads are reused, and are never freed.
+class epoch_domain {
+  friend class epoch_guard;
+
+public:
+  // The number of writes after which a writer reclaims on its own.
+  static constexpr std::size_t reclaim_threshold = 64u;
+
+  static void retire(retired_block* block,
+                     ref_count_reclaimer reclaim) noexcept {
+    block->epoch = epoch_.load(std::memory_order::acquire);
+    block->reclaim = reclaim;
+    block->next = retired_.load(std::memory_order::relaxed);
+    while (!retired_.compare_exchange_weak(block->next, block,
+                                           std::memory_order::release,
+                                           std::memory_order::relaxed)) {}
+  }
+  // Called by a writer after it has retired a block. Once the calling thread
+  // has written reclaim_threshold times since it last reclaimed, reclaims the
+  // blocks that are safe, so that they stay bounded even if reclaim() is never
+  // called otherwise.
+  static void collect() noexcept {
+    if (++writes_ >= reclaim_threshold) {
+      reclaim();
+    }
+  }
+  static std::size_t reclaim() noexcept {
+    writes_ = 0u;
+    reclaim_mutex_.lock();
+    for (int i = 0; i < 2 && try_advance(); ++i) {}
+    std::uint64_t epoch = epoch_.load(std::memory_order::acquire);
+    retired_block* pending =
+        retired_.exchange(nullptr, std::memory_order::acquire);
+    retired_block *safe = nullptr, *kept = nullptr, *kept_tail = nullptr;
+    while (pending != nullptr) {
+      retired_block* block = std::exchange(pending, pending->next);
+      if (block->epoch + 2u <= epoch) {
+        block->next = safe;
+        safe = block;
+      } else {
+        block->next = kept;
+        kept = block;
+        if (kept_tail == nullptr) {
+          kept_tail = block;
+        }
+      }
+    }
+    if (kept != nullptr) {
+      kept_tail->next = retired_.load(std::memory_order::relaxed);
+      while (!retired_.compare_exchange_weak(kept_tail->next, kept,
+                                             std::memory_order::release,
+                                             std::memory_order::relaxed)) {}
+    }
+    reclaim_mutex_.unlock();
+    std::size_t result = 0u;
+    while (safe != nullptr) {
+      retired_block* block = std::exchange(safe, safe->next);
+      block->reclaim(block);
+      ++result;
+    }
+    return result;
+  }
+
+private:
+  struct participant {
+    std::atomic<std::uint64_t> epoch = 0u;
+    std::atomic_bool in_use = true;
+    participant* next = nullptr;
+  };
+  struct binding {
+    binding() {
+      for (participant* p = participants_.load(std::memory_order::acquire);
+           p != nullptr; p = p->next) {
+        if (!p->in_use.exchange(true, std::memory_order::relaxed)) {
+          self_ = p;
+          return;
+        }
+      }
+      self_ = new participant();
+      self_->next = participants_.load(std::memory_order::relaxed);
+      while (!participants_.compare_exchange_weak(
+          self_->next, self_, std::memory_order::release,
+          std::memory_order::relaxed)) {}
+    }
+    ~binding() { self_->in_use.store(false, std::memory_order::release); }
+  };
+
+  static participant* self() {
+    static thread_local binding instance;
+    return self_;
+  }
+  static void enter() {
+    if (depth_++ == 0u) {
+      participant* p = self();
+      p->epoch.store(epoch_.load(std::memory_order::relaxed),
+                     std::memory_order::relaxed);
+      std::atomic_thread_fence(std::memory_order::seq_cst);
+    }
+  }
+  static void leave() noexcept {
+    if (--depth_ == 0u) {
+      self_->epoch.store(0u, std::memory_order::release);
+    }
+  }
+  static bool try_advance() noexcept {
+    std::uint64_t epoch = epoch_.load(std::memory_order::relaxed);
+    std::atomic_thread_fence(std::memory_order::seq_cst);
+    for (participant* p = participants_.load(std::memory_order::acquire);
+         p != nullptr; p = p->next) {
+      std::uint64_t observed = p->epoch.load(std::memory_order::acquire);
+      if (observed != 0u && observed != epoch) {
+        return false;
+      }
+    }
+    return epoch_.compare_exchange_strong(epoch, epoch + 1u,
+                                          std::memory_order::acq_rel);
+  }
+
+  static inline std::atomic<std::uint64_t> epoch_ = 1u;
+  static inline std::atomic<participant*> participants_ = nullptr;
+  static inline std::atomic<retired_block*> retired_ = nullptr;
+  static inline spin_mutex reclaim_mutex_;
+  static inline thread_local participant* self_ = nullptr;
+  static inline thread_local std::size_t depth_ = 0u;
+  static inline thread_local std::size_t writes_ = 0u;
+};
+class epoch_guard {
+public:
+  epoch_guard() { epoch_domain::enter(); }
+  epoch_guard(const epoch_guard&) = delete;
+  ~epoch_guard() { epoch_domain::leave(); }
+};
+
+// Reference count whose last release retires the storage to epoch_domain
+// instead of reclaiming it on the releasing thread.
+class deferred_ref_count {
+public:
+  using weak_count_type = atomic_ref_count;
+
+  deferred_ref_count() = default;
+  deferred_ref_count(const deferred_ref_count&) = delete;
+
+  void acquire() noexcept { count_.acquire(); }
+  bool try_acquire() noexcept { return count_.try_acquire(); }
+  bool release(ref_count_reclaimer reclaim) noexcept {
+    if (count_.release()) {
+      epoch_domain::retire(&block_, reclaim);
+    }
+    return false;
+  }
+  bool expired() const noexcept { return count_.expired(); }
+
+private:
+  retired_block block_;
+  atomic_ref_count count_;
+};
+
+// A proxy published by atomic_proxy or rcu_cell. Readers access the value
+// inside an epoch_guard; once replaced, the node is retired to epoch_domain
+// and destroyed when no reader can still be accessing it.
+template <class F>
+struct published_proxy : retired_block {
+  explicit published_proxy(proxy<F>&& value) : value(std::move(value)) {}
+
+  static published_proxy* make(proxy<F>&& value) {
+    return value.has_value() ? new published_proxy(std::move(value))
+                             : nullptr;
+  }
+  static void retire(published_proxy* node) noexcept {
+    if (node != nullptr) {
+      // Pairs with the fence of a reader entering its guard: either the
+      // reader observes the new node, or the epoch read by retire() is not
+      // ahead of the one the reader announced
+      std::atomic_thread_fence(std::memory_order::seq_cst);
+      epoch_domain::retire(node, [](void* block) noexcept {
+        delete static_cast<published_proxy*>(
+            static_cast<retired_block*>(block));
+      });
+    }
+  }
+
+  proxy<F> value;
+};
+
+// Hazard pointers that let a weak_compact_ptr borrow the value without
+// acquiring a strong reference. A borrower publishes the address of the strong
+// count in a slot of its thread before checking that the count has not
+// expired. A thread that releases the last strong reference scans the slots
+// before destroying the value; if the value is borrowed, it marks the slot and
+// hands the destruction over to the borrower. The slots of a thread that is not
+// borrowing any value are skipped, and a value whose count is local to a thread
+// can only be borrowed by that thread, so only its own slots are checked. Each
+// thread has a few slots for nested borrows; the records of exited threads are
+// reused, and are never freed.
+class hazard_domain {
+public:
+  static constexpr std::size_t slots_per_thread = 4u;
+
+  // Returns nullptr if the calling thread has no free slot.
+  template <bool IsLocal>
+  static std::atomic<std::uintptr_t>* protect(const void* block) {
+    static thread_local binding instance;
+    if (depth_ == slots_per_thread) [[unlikely]] {
+      return nullptr;
+    }
+    std::atomic<std::uintptr_t>* slot = &self_->slots[depth_++];
+    slot->store(reinterpret_cast<std::uintptr_t>(block),
+                std::memory_order::relaxed);
+    if constexpr (!IsLocal) {
+      self_->active.store(depth_, std::memory_order::relaxed);
+      std::atomic_thread_fence(std::memory_order::seq_cst);
+    }
+    return slot;
+  }
+  template <bool IsLocal>
+  static void unprotect(std::atomic<std::uintptr_t>* slot,
+                        ref_count_reclaimer reclaim) {
+    std::uintptr_t value = slot->exchange(0u, std::memory_order::acq_rel);
+    --depth_;
+    if constexpr (!IsLocal) {
+      self_->active.store(depth_, std::memory_order::release);
+    }
+    if ((value & handed_over) != 0u) [[unlikely]] {
+      retire<IsLocal>(reinterpret_cast<void*>(value & ~handed_over), reclaim);
+    }
+  }
+  template <bool IsLocal>
+  static void retire(void* block, ref_count_reclaimer reclaim) {
+    std::uintptr_t address = reinterpret_cast<std::uintptr_t>(block);
+    if constexpr (IsLocal) {
+      if (depth_ != 0u && hand_over(*self_, address)) {
+        return;
+      }
+    } else {
+      // Either a borrower observes the expired count, or its slot and its
+      // active count are visible here
+      std::atomic_thread_fence(std::memory_order::seq_cst);
+      for (record* r = records_.load(std::memory_order::acquire); r != nullptr;
+           r = r->next) {
+        if (r->active.load(std::memory_order::acquire) != 0u &&
+            hand_over(*r, address)) [[unlikely]] {
+          return;
+        }
+      }
+    }
+    reclaim(block);
+  }
+
+private:
+  static constexpr std::uintptr_t handed_over = 1u;
+
+  // Aligned so that the records of different threads do not share a cache
+  // line.
+  struct alignas(64) record {
+    std::atomic<std::uintptr_t> slots[slots_per_thread] = {};
+    // The number of slots in use, so that idle threads are skipped by a scan
+    std::atomic<std::size_t> active = 0u;
+    std::atomic_bool in_use = true;
+    record* next = nullptr;
+  };
+  struct binding {
+    binding() {
+      for (record* r = records_.load(std::memory_order::acquire); r != nullptr;
+           r = r->next) {
+        if (!r->in_use.exchange(true, std::memory_order::relaxed)) {
+          self_ = r;
+          return;
+        }
+      }
+      self_ = new record();
+      self_->next = records_.load(std::memory_order::relaxed);
+      while (!records_.compare_exchange_weak(self_->next, self_,
+                                             std::memory_order::release,
+                                             std::memory_order::relaxed)) {}
+    }
+    ~binding() { self_->in_use.store(false, std::memory_order::release); }
+  };
+
+  static bool hand_over(record& r, std::uintptr_t address) noexcept {
+    for (std::atomic<std::uintptr_t>& slot : r.slots) {
+      std::uintptr_t expected = address;
+      if (slot.load(std::memory_order::relaxed) == address &&
+          slot.compare_exchange_strong(expected, address | handed_over,
+                                       std::memory_order::acq_rel,
+                                       std::memory_order::relaxed)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  static inline std::atomic<record*> records_ = nullptr;
+  static inline thread_local record* self_ = nullptr;
+  static inline thread_local std::size_t depth_ = 0u;
 };
 
+template <class RC>
 struct shared_compact_ptr_storage_base {
-  std::atomic_long ref_count = 1;
+  RC ref_count;
 };
-template <class T, class Alloc>
+template <class T, class Alloc, class RC>
 struct PRO4D_ENFORCE_EBO shared_compact_ptr_storage
-    : shared_compact_ptr_storage_base,
+    : shared_compact_ptr_storage_base<RC>,
       alloc_aware<Alloc>,
       inplace_ptr<T> {
   template <class... Args>
@@ -1609,10 +3928,10 @@ struct PRO4D_ENFORCE_EBO shared_compact_ptr_storage
       : alloc_aware<Alloc>(alloc),
         inplace_ptr<T>(std::in_place, std::forward<Args>(args)...) {}
 };
-template <class T, class Alloc>
+template <class T, class Alloc, class RC = atomic_ref_count>
 class shared_compact_ptr
-    : public indirect_ptr<shared_compact_ptr_storage<T, Alloc>> {
-  using Storage = shared_compact_ptr_storage<T, Alloc>;
+    : public indirect_ptr<shared_compact_ptr_storage<T, Alloc, RC>> {
+  using Storage = shared_compact_ptr_storage<T, Alloc, RC>;
 
 public:
   template <class... Args>
@@ -1621,22 +3940,68 @@ public:
             allocate<Storage>(alloc, alloc, std::forward<Args>(args)...)) {}
   shared_compact_ptr(const shared_compact_ptr& rhs) noexcept
       : indirect_ptr<Storage>(rhs.ptr_) {
-    this->ptr_->ref_count.fetch_add(1, std::memory_order::relaxed);
+    this->ptr_->ref_count.acquire();
   }
   shared_compact_ptr(shared_compact_ptr&& rhs) = delete;
   ~shared_compact_ptr() noexcept(std::is_nothrow_destructible_v<T>) {
-    if (this->ptr_->ref_count.fetch_sub(1, std::memory_order::acq_rel) == 1) {
-      deallocate(this->ptr_->alloc, this->ptr_);
+    if (this->ptr_->ref_count.release(&reclaim)) {
+      reclaim(&this->ptr_->ref_count);
     }
   }
+
+private:
+  static void reclaim(void* rc) noexcept(std::is_nothrow_destructible_v<T>) {
+    static_assert(
+        std::is_standard_layout_v<shared_compact_ptr_storage_base<RC>>);
+    auto* storage = static_cast<Storage*>(
+        static_cast<shared_compact_ptr_storage_base<RC>*>(rc));
+    deallocate(storage->alloc, storage);
+  }
 };
 
+// Shares the value with its copies, and clones it before it is accessed through
+// a non-const pointer while other copies exist.
+template <class T, class Alloc>
+class cow_ptr : public shared_compact_ptr<T, Alloc> {
+public:
+  using shared_compact_ptr<T, Alloc>::shared_compact_ptr;
+  cow_ptr(const cow_ptr&) noexcept = default;
+  cow_ptr(cow_ptr&& rhs) = delete;
+
+  T* operator->() {
+    unshare();
+    return std::addressof(**this->ptr_);
+  }
+  const T* operator->() const noexcept { return std::addressof(**this->ptr_); }
+  T& operator*() & {
+    unshare();
+    return **this->ptr_;
+  }
+  const T& operator*() const& noexcept { return **this->ptr_; }
+  T&& operator*() && {
+    unshare();
+    return std::move(**this->ptr_);
+  }
+  const T&& operator*() const&& noexcept { return std::move(**this->ptr_); }
+
+private:
+  void unshare() {
+    if (!this->ptr_->ref_count.unique()) {
+      cow_ptr clone{this->ptr_->alloc, std::as_const(**this->ptr_)};
+      std::swap(this->ptr_, clone.ptr_);
+    }
+  }
+};
+
+template <class RC>
 struct strong_weak_compact_ptr_storage_base {
-  std::atomic_long strong_count = 1, weak_count = 1;
+  RC strong_count;
+  typename RC::weak_count_type weak_count;
 };
-template <class T, class Alloc>
-struct strong_weak_compact_ptr_storage : strong_weak_compact_ptr_storage_base,
-                                         alloc_aware<Alloc> {
+template <class T, class Alloc, class RC>
+struct strong_weak_compact_ptr_storage
+    : strong_weak_compact_ptr_storage_base<RC>,
+      alloc_aware<Alloc> {
   template <class... Args>
   explicit strong_weak_compact_ptr_storage(const Alloc& alloc, Args&&... args)
       : alloc_aware<Alloc>(alloc) {
@@ -1646,30 +4011,27 @@ struct strong_weak_compact_ptr_storage : strong_weak_compact_ptr_storage_base,
 
   alignas(alignof(T)) std::byte value[sizeof(T)];
 };
-template <class T, class Alloc>
+template <class T, class Alloc, class RC = atomic_ref_count>
 class weak_compact_ptr;
-template <class T, class Alloc>
+template <class T, class Alloc, class RC = atomic_ref_count>
 class strong_compact_ptr {
-  using Storage = strong_weak_compact_ptr_storage<T, Alloc>;
-  friend class weak_compact_ptr<T, Alloc>;
+  using Storage = strong_weak_compact_ptr_storage<T, Alloc, RC>;
+  friend class weak_compact_ptr<T, Alloc, RC>;
 
 public:
-  using weak_type = weak_compact_ptr<T, Alloc>;
+  using weak_type = weak_compact_ptr<T, Alloc, RC>;
 
   explicit strong_compact_ptr(Storage* ptr) noexcept : ptr_(ptr) {}
   template <class... Args>
   strong_compact_ptr(const Alloc& alloc, Args&&... args)
       : ptr_(allocate<Storage>(alloc, alloc, std::forward<Args>(args)...)) {}
   strong_compact_ptr(const strong_compact_ptr& rhs) noexcept : ptr_(rhs.ptr_) {
-    ptr_->strong_count.fetch_add(1, std::memory_order::relaxed);
+    ptr_->strong_count.acquire();
   }
   strong_compact_ptr(strong_compact_ptr&& rhs) = delete;
   ~strong_compact_ptr() noexcept(std::is_nothrow_destructible_v<T>) {
-    if (ptr_->strong_count.fetch_sub(1, std::memory_order::acq_rel) == 1) {
-      std::destroy_at(operator->());
-      if (ptr_->weak_count.fetch_sub(1u, std::memory_order::release) == 1) {
-        deallocate(ptr_->alloc, ptr_);
-      }
+    if (ptr_->strong_count.release(&retire)) {
+      retire(&ptr_->strong_count);
     }
   }
   T* operator->() noexcept {
@@ -1684,79 +4046,239 @@ public:
   const T&& operator*() const&& noexcept { return std::move(*operator->()); }
 
 private:
-  strong_weak_compact_ptr_storage<T, Alloc>* ptr_;
+  static void reclaim(void* rc) noexcept(std::is_nothrow_destructible_v<T>) {
+    static_assert(std::is_standard_layout_v<
+                  strong_weak_compact_ptr_storage_base<RC>>);
+    auto* storage = static_cast<Storage*>(
+        static_cast<strong_weak_compact_ptr_storage_base<RC>*>(rc));
+    std::destroy_at(std::launder(reinterpret_cast<T*>(&storage->value)));
+    if (storage->weak_count.release()) {
+      deallocate(storage->alloc, storage);
+    }
+  }
+  // The value may still be borrowed by weak_compact_ptr::with_locked().
+  static void retire(void* rc) noexcept(std::is_nothrow_destructible_v<T>) {
+    hazard_domain::retire<std::is_same_v<RC, local_ref_count>>(rc, &reclaim);
+  }
+
+  strong_weak_compact_ptr_storage<T, Alloc, RC>* ptr_;
 };
-template <class T, class Alloc>
+template <class T, class Alloc, class RC>
 class weak_compact_ptr {
 public:
   using element_type = T;
 
-  weak_compact_ptr(const strong_compact_ptr<T, Alloc>& rhs) noexcept
+  weak_compact_ptr(const strong_compact_ptr<T, Alloc, RC>& rhs) noexcept
       : ptr_(rhs.ptr_) {
-    ptr_->weak_count.fetch_add(1, std::memory_order::relaxed);
+    ptr_->weak_count.acquire();
   }
   weak_compact_ptr(const weak_compact_ptr& rhs) noexcept : ptr_(rhs.ptr_) {
-    ptr_->weak_count.fetch_add(1, std::memory_order::relaxed);
+    ptr_->weak_count.acquire();
   }
   weak_compact_ptr(weak_compact_ptr&& rhs) = delete;
   ~weak_compact_ptr() noexcept {
-    if (ptr_->weak_count.fetch_sub(1u, std::memory_order::acq_rel) == 1) {
+    if (ptr_->weak_count.release()) {
       deallocate(ptr_->alloc, ptr_);
     }
   }
   auto lock() const noexcept {
     return converter{[ptr = this->ptr_]<class F>(
                          std::in_place_type_t<proxy<F>>) noexcept -> proxy<F> {
-      long ref_count = ptr->strong_count.load(std::memory_order::relaxed);
-      do {
-        if (ref_count == 0) {
-          return proxy<F>{};
-        }
-      } while (!ptr->strong_count.compare_exchange_weak(
-          ref_count, ref_count + 1, std::memory_order::relaxed));
-      return proxy<F>{std::in_place_type<strong_compact_ptr<T, Alloc>>, ptr};
+      if (!ptr->strong_count.try_acquire()) {
+        return proxy<F>{};
+      }
+      return proxy<F>{std::in_place_type<strong_compact_ptr<T, Alloc, RC>>,
+                      ptr};
     }};
   }
+  // Unlike lock(), borrows the value without acquiring a strong reference.
+  template <class F>
+  bool with_locked(weak_borrow_callback<F> fn) const {
+    using Strong = strong_compact_ptr<T, Alloc, RC>;
+    constexpr bool is_local = std::is_same_v<RC, local_ref_count>;
+    std::atomic<std::uintptr_t>* slot =
+        hazard_domain::protect<is_local>(&ptr_->strong_count);
+    if (slot == nullptr) [[unlikely]] {
+      if (!ptr_->strong_count.try_acquire()) {
+        return false;
+      }
+      Strong strong{ptr_};
+      fn(*strong);
+      return true;
+    }
+    struct guard {
+      ~guard() noexcept(std::is_nothrow_destructible_v<T>) {
+        hazard_domain::unprotect<is_local>(slot, &Strong::reclaim);
+      }
+      std::atomic<std::uintptr_t>* slot;
+    } g{slot};
+    if (ptr_->strong_count.expired()) {
+      return false;
+    }
+    fn(*std::launder(reinterpret_cast<T*>(&ptr_->value)));
+    return true;
+  }
+
+private:
+  strong_weak_compact_ptr_storage<T, Alloc, RC>* ptr_;
+};
+
+// Marker reflection added by skills::shared_ownership. Only pointers that share
+// their value through a thread-safe reference count are proxiable, so that the
+// address of the value identifies a proxy and its copies on any thread.
+template <class P>
+constexpr bool is_shared_ownership_ptr = false;
+template <class T, class Alloc, class RC>
+constexpr bool is_shared_ownership_ptr<shared_compact_ptr<T, Alloc, RC>> =
+    !std::is_same_v<RC, local_ref_count>;
+template <class T, class Alloc, class RC>
+constexpr bool is_shared_ownership_ptr<strong_compact_ptr<T, Alloc, RC>> =
+    !std::is_same_v<RC, local_ref_count>;
+struct shared_ownership_reflector {
+  shared_ownership_reflector() = default;
+  template <class P>
+    requires(is_shared_ownership_ptr<P>)
+  constexpr explicit shared_ownership_reflector(
+      std::in_place_type_t<P>) noexcept {}
+};
+template <class... Rs>
+struct shared_ownership_traits
+    : std::bool_constant<(std::is_same_v<typename Rs::reflector_type,
+                                         shared_ownership_reflector> ||
+                          ...)> {};
+
+// Up to 255 live compact_arena objects are registered process-wide, so that an
+// arena_ptr can refer to an object with a 32-bit value: the 8-bit id of the
+// arena followed by a 24-bit offset in units of `granularity` bytes.
+struct compact_arena_registry {
+  static constexpr std::size_t granularity = 8u;
+  static constexpr std::uint32_t offset_bits = 24u;
+  static constexpr std::uint32_t max_arenas = 256u;
+  static inline std::atomic<compact_arena*> arenas[max_arenas];
+  // Written by the arena that owns the slot after claiming it. A handle only
+  // reaches another thread through synchronization that happens after the
+  // write, so that it is loaded with relaxed order.
+  static inline std::atomic<std::byte*> bases[max_arenas];
+};
+template <class T>
+class arena_ptr {
+  static_assert(alignof(T) <= compact_arena_registry::granularity);
+
+public:
+  template <class... Args>
+  explicit arena_ptr(compact_arena& arena, Args&&... args);
+  arena_ptr(const arena_ptr& rhs)
+    requires(std::is_copy_constructible_v<T>);
+  arena_ptr(arena_ptr&& rhs) = delete;
+  ~arena_ptr() noexcept(std::is_nothrow_destructible_v<T>) {
+    std::destroy_at(operator->());
+  }
+  T* operator->() noexcept {
+    return std::launder(reinterpret_cast<T*>(address()));
+  }
+  const T* operator->() const noexcept {
+    return std::launder(reinterpret_cast<const T*>(address()));
+  }
+  T& operator*() & noexcept { return *operator->(); }
+  const T& operator*() const& noexcept { return *operator->(); }
+  T&& operator*() && noexcept { return std::move(*operator->()); }
+  const T&& operator*() const&& noexcept { return std::move(*operator->()); }
 
 private:
-  strong_weak_compact_ptr_storage<T, Alloc>* ptr_;
+  std::byte* address() const noexcept {
+    std::byte* base =
+        compact_arena_registry::bases[value_ >>
+                                      compact_arena_registry::offset_bits]
+            .load(std::memory_order::relaxed);
+    // The arena has been destroyed. If its identifier has been reused, the
+    // handle silently refers to the memory of the new arena instead.
+    assert(base != nullptr);
+    return base +
+           (value_ &
+            ((std::uint32_t{1} << compact_arena_registry::offset_bits) - 1u)) *
+               compact_arena_registry::granularity;
+  }
+
+  std::uint32_t value_;
 };
+template <class T>
+class proxy_arena_ptr {
+public:
+  template <class... Args>
+  explicit proxy_arena_ptr(proxy_arena& arena, Args&&... args);
+  proxy_arena_ptr(const proxy_arena_ptr& rhs)
+    requires(std::is_copy_constructible_v<T>);
+  proxy_arena_ptr(proxy_arena_ptr&& rhs) = delete;
+  ~proxy_arena_ptr()
+    requires(std::is_trivially_destructible_v<T>)
+  = default;
+  ~proxy_arena_ptr() noexcept(std::is_nothrow_destructible_v<T>)
+    requires(!std::is_trivially_destructible_v<T>)
+  {
+    std::destroy_at(ptr_);
+  }
+  T* operator->() noexcept { return ptr_; }
+  const T* operator->() const noexcept { return ptr_; }
+  T& operator*() & noexcept { return *ptr_; }
+  const T& operator*() const& noexcept { return *ptr_; }
+  T&& operator*() && noexcept { return std::move(*ptr_); }
+  const T&& operator*() const&& noexcept { return std::move(*ptr_); }
+
+private:
+  T* ptr_;
+};
+
+template <class F, class T, class Alloc>
+struct allocated_ptr_traits : std::type_identity<allocated_ptr<T, Alloc>> {};
+template <class F, class T, class Alloc>
+  requires(
+      instantiated_t<cow_traits, typename F::reflection_types>::value &&
+      std::is_copy_constructible_v<T> && proxiable<cow_ptr<T, Alloc>, F>)
+struct allocated_ptr_traits<F, T, Alloc>
+    : std::type_identity<cow_ptr<T, Alloc>> {};
+template <class F, class T, class Alloc>
+using allocated_ptr_t = typename allocated_ptr_traits<F, T, Alloc>::type;
 
 template <class F, class T, class Alloc, class... Args>
 constexpr proxy<F> allocate_proxy_impl(const Alloc& alloc, Args&&... args) {
-  if constexpr (proxiable<allocated_ptr<T, Alloc>, F>) {
-    return proxy<F>{std::in_place_type<allocated_ptr<T, Alloc>>, alloc,
+  if constexpr (proxiable<allocated_ptr_t<F, T, Alloc>, F>) {
+    return proxy<F>{std::in_place_type<allocated_ptr_t<F, T, Alloc>>, alloc,
                     std::forward<Args>(args)...};
   } else {
     return proxy<F>{std::in_place_type<compact_ptr<T, Alloc>>, alloc,
                     std::forward<Args>(args)...};
   }
 }
+template <class F>
+using default_alloc_t = std::conditional_t<
+    instantiated_t<thread_caching_traits, typename F::reflection_types>::value,
+    thread_caching_allocator<void>, std::allocator<void>>;
 template <class F, class T, class... Args>
 constexpr proxy<F> make_proxy_impl(Args&&... args) {
   if constexpr (proxiable<inplace_ptr<T>, F>) {
     return proxy<F>{std::in_place_type<inplace_ptr<T>>, std::in_place,
                     std::forward<Args>(args)...};
   } else {
-    return allocate_proxy_impl<F, T>(std::allocator<void>{},
+    return allocate_proxy_impl<F, T>(default_alloc_t<F>{},
                                      std::forward<Args>(args)...);
   }
 }
-template <class F, class T, class Alloc, class... Args>
+template <class F, class T, class RC = atomic_ref_count, class Alloc,
+          class... Args>
 constexpr proxy<F> allocate_proxy_shared_impl(const Alloc& alloc,
                                               Args&&... args) {
   if constexpr (std::is_convertible_v<proxy<F>, weak_proxy<F>>) {
-    return proxy<F>{std::in_place_type<strong_compact_ptr<T, Alloc>>, alloc,
-                    std::forward<Args>(args)...};
+    return proxy<F>{std::in_place_type<strong_compact_ptr<T, Alloc, RC>>,
+                    alloc, std::forward<Args>(args)...};
   } else {
-    return proxy<F>{std::in_place_type<shared_compact_ptr<T, Alloc>>, alloc,
-                    std::forward<Args>(args)...};
+    return proxy<F>{std::in_place_type<shared_compact_ptr<T, Alloc, RC>>,
+                    alloc, std::forward<Args>(args)...};
   }
 }
-template <class F, class T, class... Args>
+template <class F, class T, class RC = atomic_ref_count, class... Args>
 constexpr proxy<F> make_proxy_shared_impl(Args&&... args) {
-  return allocate_proxy_shared_impl<F, T>(std::allocator<void>{},
-                                          std::forward<Args>(args)...);
+  return allocate_proxy_shared_impl<F, T, RC>(default_alloc_t<F>{},
+                                              std::forward<Args>(args)...);
 }
 #endif // __STDC_HOSTED__
 
@@ -1823,15 +4345,18 @@ struct is_bitwise_trivially_relocatable<details::allocated_ptr<T, Alloc>>
 template <class T, class Alloc>
 struct is_bitwise_trivially_relocatable<details::compact_ptr<T, Alloc>>
     : std::true_type {};
+template <class T, class Alloc, class RC>
+struct is_bitwise_trivially_relocatable<
+    details::shared_compact_ptr<T, Alloc, RC>> : std::true_type {};
 template <class T, class Alloc>
-struct is_bitwise_trivially_relocatable<details::shared_compact_ptr<T, Alloc>>
-    : std::true_type {};
-template <class T, class Alloc>
-struct is_bitwise_trivially_relocatable<details::strong_compact_ptr<T, Alloc>>
-    : std::true_type {};
-template <class T, class Alloc>
-struct is_bitwise_trivially_relocatable<details::weak_compact_ptr<T, Alloc>>
+struct is_bitwise_trivially_relocatable<details::cow_ptr<T, Alloc>>
     : std::true_type {};
+template <class T, class Alloc, class RC>
+struct is_bitwise_trivially_relocatable<
+    details::strong_compact_ptr<T, Alloc, RC>> : std::true_type {};
+template <class T, class Alloc, class RC>
+struct is_bitwise_trivially_relocatable<
+    details::weak_compact_ptr<T, Alloc, RC>> : std::true_type {};
 
 template <facade F, class T, class Alloc, class... Args>
 constexpr proxy<F> allocate_proxy(const Alloc& alloc, Args&&... args)
@@ -1844,77 +4369,567 @@ constexpr proxy<F> allocate_proxy(const Alloc& alloc,
                                   std::initializer_list<U> il, Args&&... args)
   requires(std::is_constructible_v<T, std::initializer_list<U>&, Args...>)
 {
-  return details::allocate_proxy_impl<F, T>(alloc, il,
-                                            std::forward<Args>(args)...);
+  return details::allocate_proxy_impl<F, T>(alloc, il,
+                                            std::forward<Args>(args)...);
+}
+template <facade F, class Alloc, class T>
+constexpr proxy<F> allocate_proxy(const Alloc& alloc, T&& value)
+  requires(std::is_constructible_v<std::decay_t<T>, T>)
+{
+  return details::allocate_proxy_impl<F, std::decay_t<T>>(
+      alloc, std::forward<T>(value));
+}
+template <facade F, class T, class... Args>
+constexpr proxy<F> make_proxy(Args&&... args)
+  requires(std::is_constructible_v<T, Args...>)
+{
+  return details::make_proxy_impl<F, T>(std::forward<Args>(args)...);
+}
+template <facade F, class T, class U, class... Args>
+constexpr proxy<F> make_proxy(std::initializer_list<U> il, Args&&... args)
+  requires(std::is_constructible_v<T, std::initializer_list<U>&, Args...>)
+{
+  return details::make_proxy_impl<F, T>(il, std::forward<Args>(args)...);
+}
+template <facade F, class T>
+constexpr proxy<F> make_proxy(T&& value)
+  requires(std::is_constructible_v<std::decay_t<T>, T>)
+{
+  return details::make_proxy_impl<F, std::decay_t<T>>(std::forward<T>(value));
+}
+
+template <facade F, class T, class Alloc, class... Args>
+constexpr proxy<F> allocate_proxy_shared(const Alloc& alloc, Args&&... args)
+  requires(std::is_constructible_v<T, Args...>)
+{
+  return details::allocate_proxy_shared_impl<F, T>(alloc,
+                                                   std::forward<Args>(args)...);
+}
+template <facade F, class T, class Alloc, class U, class... Args>
+constexpr proxy<F> allocate_proxy_shared(const Alloc& alloc,
+                                         std::initializer_list<U> il,
+                                         Args&&... args)
+  requires(std::is_constructible_v<T, std::initializer_list<U>&, Args...>)
+{
+  return details::allocate_proxy_shared_impl<F, T>(alloc, il,
+                                                   std::forward<Args>(args)...);
+}
+template <facade F, class Alloc, class T>
+constexpr proxy<F> allocate_proxy_shared(const Alloc& alloc, T&& value)
+  requires(std::is_constructible_v<std::decay_t<T>, T>)
+{
+  return details::allocate_proxy_shared_impl<F, std::decay_t<T>>(
+      alloc, std::forward<T>(value));
+}
+template <facade F, class T, class... Args>
+constexpr proxy<F> make_proxy_shared(Args&&... args)
+  requires(std::is_constructible_v<T, Args...>)
+{
+  return details::make_proxy_shared_impl<F, T>(std::forward<Args>(args)...);
+}
+template <facade F, class T, class U, class... Args>
+constexpr proxy<F> make_proxy_shared(std::initializer_list<U> il,
+                                     Args&&... args)
+  requires(std::is_constructible_v<T, std::initializer_list<U>&, Args...>)
+{
+  return details::make_proxy_shared_impl<F, T>(il, std::forward<Args>(args)...);
+}
+template <facade F, class T>
+constexpr proxy<F> make_proxy_shared(T&& value)
+  requires(std::is_constructible_v<std::decay_t<T>, T>)
+{
+  return details::make_proxy_shared_impl<F, std::decay_t<T>>(
+      std::forward<T>(value));
+}
+
+template <facade F, class T, class Alloc, class... Args>
+constexpr proxy<F> allocate_proxy_shared_local(const Alloc& alloc,
+                                               Args&&... args)
+  requires(std::is_constructible_v<T, Args...>)
+{
+  return details::allocate_proxy_shared_impl<F, T, details::local_ref_count>(
+      alloc, std::forward<Args>(args)...);
+}
+template <facade F, class T, class Alloc, class U, class... Args>
+constexpr proxy<F> allocate_proxy_shared_local(const Alloc& alloc,
+                                               std::initializer_list<U> il,
+                                               Args&&... args)
+  requires(std::is_constructible_v<T, std::initializer_list<U>&, Args...>)
+{
+  return details::allocate_proxy_shared_impl<F, T, details::local_ref_count>(
+      alloc, il, std::forward<Args>(args)...);
+}
+template <facade F, class Alloc, class T>
+constexpr proxy<F> allocate_proxy_shared_local(const Alloc& alloc, T&& value)
+  requires(std::is_constructible_v<std::decay_t<T>, T>)
+{
+  return details::allocate_proxy_shared_impl<F, std::decay_t<T>,
+                                             details::local_ref_count>(
+      alloc, std::forward<T>(value));
+}
+template <facade F, class T, class... Args>
+constexpr proxy<F> make_proxy_shared_local(Args&&... args)
+  requires(std::is_constructible_v<T, Args...>)
+{
+  return details::make_proxy_shared_impl<F, T, details::local_ref_count>(
+      std::forward<Args>(args)...);
+}
+template <facade F, class T, class U, class... Args>
+constexpr proxy<F> make_proxy_shared_local(std::initializer_list<U> il,
+                                           Args&&... args)
+  requires(std::is_constructible_v<T, std::initializer_list<U>&, Args...>)
+{
+  return details::make_proxy_shared_impl<F, T, details::local_ref_count>(
+      il, std::forward<Args>(args)...);
+}
+template <facade F, class T>
+constexpr proxy<F> make_proxy_shared_local(T&& value)
+  requires(std::is_constructible_v<std::decay_t<T>, T>)
+{
+  return details::make_proxy_shared_impl<F, std::decay_t<T>,
+                                         details::local_ref_count>(
+      std::forward<T>(value));
+}
+
+template <facade F, class T, class Alloc, class... Args>
+constexpr proxy<F> allocate_proxy_shared_biased(const Alloc& alloc,
+                                               Args&&... args)
+  requires(std::is_constructible_v<T, Args...>)
+{
+  return details::allocate_proxy_shared_impl<F, T, details::biased_ref_count>(
+      alloc, std::forward<Args>(args)...);
+}
+template <facade F, class T, class Alloc, class U, class... Args>
+constexpr proxy<F> allocate_proxy_shared_biased(const Alloc& alloc,
+                                               std::initializer_list<U> il,
+                                               Args&&... args)
+  requires(std::is_constructible_v<T, std::initializer_list<U>&, Args...>)
+{
+  return details::allocate_proxy_shared_impl<F, T, details::biased_ref_count>(
+      alloc, il, std::forward<Args>(args)...);
+}
+template <facade F, class Alloc, class T>
+constexpr proxy<F> allocate_proxy_shared_biased(const Alloc& alloc, T&& value)
+  requires(std::is_constructible_v<std::decay_t<T>, T>)
+{
+  return details::allocate_proxy_shared_impl<F, std::decay_t<T>,
+                                             details::biased_ref_count>(
+      alloc, std::forward<T>(value));
+}
+template <facade F, class T, class... Args>
+constexpr proxy<F> make_proxy_shared_biased(Args&&... args)
+  requires(std::is_constructible_v<T, Args...>)
+{
+  return details::make_proxy_shared_impl<F, T, details::biased_ref_count>(
+      std::forward<Args>(args)...);
+}
+template <facade F, class T, class U, class... Args>
+constexpr proxy<F> make_proxy_shared_biased(std::initializer_list<U> il,
+                                           Args&&... args)
+  requires(std::is_constructible_v<T, std::initializer_list<U>&, Args...>)
+{
+  return details::make_proxy_shared_impl<F, T, details::biased_ref_count>(
+      il, std::forward<Args>(args)...);
+}
+template <facade F, class T>
+constexpr proxy<F> make_proxy_shared_biased(T&& value)
+  requires(std::is_constructible_v<std::decay_t<T>, T>)
+{
+  return details::make_proxy_shared_impl<F, std::decay_t<T>,
+                                         details::biased_ref_count>(
+      std::forward<T>(value));
+}
+
+template <facade F, class T, class Alloc, class... Args>
+constexpr proxy<F> allocate_proxy_shared_deferred(const Alloc& alloc,
+                                                 Args&&... args)
+  requires(std::is_constructible_v<T, Args...>)
+{
+  return details::allocate_proxy_shared_impl<F, T, details::deferred_ref_count>(
+      alloc, std::forward<Args>(args)...);
+}
+template <facade F, class T, class Alloc, class U, class... Args>
+constexpr proxy<F> allocate_proxy_shared_deferred(const Alloc& alloc,
+                                                 std::initializer_list<U> il,
+                                                 Args&&... args)
+  requires(std::is_constructible_v<T, std::initializer_list<U>&, Args...>)
+{
+  return details::allocate_proxy_shared_impl<F, T, details::deferred_ref_count>(
+      alloc, il, std::forward<Args>(args)...);
 }
 template <facade F, class Alloc, class T>
-constexpr proxy<F> allocate_proxy(const Alloc& alloc, T&& value)
+constexpr proxy<F> allocate_proxy_shared_deferred(const Alloc& alloc,
+                                                 T&& value)
   requires(std::is_constructible_v<std::decay_t<T>, T>)
 {
-  return details::allocate_proxy_impl<F, std::decay_t<T>>(
+  return details::allocate_proxy_shared_impl<F, std::decay_t<T>,
+                                             details::deferred_ref_count>(
       alloc, std::forward<T>(value));
 }
 template <facade F, class T, class... Args>
-constexpr proxy<F> make_proxy(Args&&... args)
+constexpr proxy<F> make_proxy_shared_deferred(Args&&... args)
   requires(std::is_constructible_v<T, Args...>)
 {
-  return details::make_proxy_impl<F, T>(std::forward<Args>(args)...);
+  return details::make_proxy_shared_impl<F, T, details::deferred_ref_count>(
+      std::forward<Args>(args)...);
 }
 template <facade F, class T, class U, class... Args>
-constexpr proxy<F> make_proxy(std::initializer_list<U> il, Args&&... args)
+constexpr proxy<F> make_proxy_shared_deferred(std::initializer_list<U> il,
+                                             Args&&... args)
   requires(std::is_constructible_v<T, std::initializer_list<U>&, Args...>)
 {
-  return details::make_proxy_impl<F, T>(il, std::forward<Args>(args)...);
+  return details::make_proxy_shared_impl<F, T, details::deferred_ref_count>(
+      il, std::forward<Args>(args)...);
 }
 template <facade F, class T>
-constexpr proxy<F> make_proxy(T&& value)
+constexpr proxy<F> make_proxy_shared_deferred(T&& value)
   requires(std::is_constructible_v<std::decay_t<T>, T>)
 {
-  return details::make_proxy_impl<F, std::decay_t<T>>(std::forward<T>(value));
+  return details::make_proxy_shared_impl<F, std::decay_t<T>,
+                                         details::deferred_ref_count>(
+      std::forward<T>(value));
 }
 
-template <facade F, class T, class Alloc, class... Args>
-constexpr proxy<F> allocate_proxy_shared(const Alloc& alloc, Args&&... args)
+inline std::size_t reclaim() noexcept {
+  return details::epoch_domain::reclaim();
+}
+
+// Readers copy the proxy held by the current node inside an epoch guard.
+// Writers replace the node and retire the previous one without waiting for
+// readers; it is destroyed, releasing its reference, by a later reclamation
+// once no reader can still be copying from it. Every writer reclaims after a
+// number of writes, so that retired nodes stay bounded.
+template <facade F>
+  requires(F::copyability != constraint_level::none &&
+           details::instantiated_t<details::shared_ownership_traits,
+                                   typename F::reflection_types>::value)
+class atomic_proxy {
+  using node = details::published_proxy<F>;
+
+public:
+  atomic_proxy() noexcept = default;
+  atomic_proxy(proxy<F> desired) : head_(node::make(std::move(desired))) {}
+  atomic_proxy(const atomic_proxy&) = delete;
+  ~atomic_proxy() { delete head_.load(std::memory_order::relaxed); }
+  atomic_proxy& operator=(const atomic_proxy&) = delete;
+  void operator=(proxy<F> desired) { store(std::move(desired)); }
+
+  proxy<F> load() const {
+    details::epoch_guard guard;
+    node* current = head_.load(std::memory_order::acquire);
+    return current == nullptr ? proxy<F>{} : current->value;
+  }
+  operator proxy<F>() const { return load(); }
+  void store(proxy<F> desired) {
+    node::retire(head_.exchange(node::make(std::move(desired)),
+                                std::memory_order::acq_rel));
+    details::epoch_domain::collect();
+  }
+  proxy<F> exchange(proxy<F> desired) {
+    node* next = node::make(std::move(desired));
+    proxy<F> result;
+    {
+      details::epoch_guard guard;
+      node* previous = head_.exchange(next, std::memory_order::acq_rel);
+      node::retire(previous);
+      if (previous != nullptr) {
+        result = previous->value;
+      }
+    }
+    details::epoch_domain::collect();
+    return result;
+  }
+  bool compare_exchange_strong(proxy<F>& expected, proxy<F> desired) {
+    node* next = nullptr;
+    {
+      details::epoch_guard guard;
+      node* current = head_.load(std::memory_order::acquire);
+      for (;;) {
+        if (current == nullptr
+                ? expected.has_value()
+                : !details::proxy_helper::is_same_pointer(current->value,
+                                                          expected)) {
+          delete next;
+          if (current == nullptr) {
+            expected.reset();
+          } else {
+            expected = current->value;
+          }
+          return false;
+        }
+        if (next == nullptr) {
+          next = node::make(std::move(desired));
+        }
+        if (head_.compare_exchange_weak(current, next,
+                                        std::memory_order::acq_rel,
+                                        std::memory_order::acquire)) {
+          node::retire(current);
+          break;
+        }
+      }
+    }
+    details::epoch_domain::collect();
+    return true;
+  }
+  bool compare_exchange_weak(proxy<F>& expected, proxy<F> desired) {
+    return compare_exchange_strong(expected, std::move(desired));
+  }
+
+private:
+  std::atomic<node*> head_ = nullptr;
+};
+
+// Readers view the proxy held by the current node inside an epoch guard,
+// without modifying any reference count. Writers replace the node and retire
+// the previous one, which a later reclamation destroys after a grace period.
+// Every writer reclaims after a number of writes.
+template <facade F>
+  requires(std::is_convertible_v<proxy<F>&, proxy_view<F>>)
+class rcu_cell {
+  using node = details::published_proxy<F>;
+
+public:
+  rcu_cell() noexcept = default;
+  rcu_cell(proxy<F> value) : head_(node::make(std::move(value))) {}
+  rcu_cell(const rcu_cell&) = delete;
+  ~rcu_cell() { delete head_.load(std::memory_order::relaxed); }
+  rcu_cell& operator=(const rcu_cell&) = delete;
+  void operator=(proxy<F> value) { store(std::move(value)); }
+
+  template <class Fn>
+  decltype(auto) read(Fn&& fn) const
+    requires(std::is_invocable_v<Fn, proxy_view<F>>)
+  {
+    details::epoch_guard guard;
+    node* current = head_.load(std::memory_order::acquire);
+    return std::forward<Fn>(fn)(current == nullptr
+                                    ? proxy_view<F>{}
+                                    : proxy_view<F>{current->value});
+  }
+  void store(proxy<F> value) {
+    node::retire(head_.exchange(node::make(std::move(value)),
+                                std::memory_order::acq_rel));
+    details::epoch_domain::collect();
+  }
+
+private:
+  std::atomic<node*> head_ = nullptr;
+};
+
+class compact_arena {
+  template <class T>
+  friend class details::arena_ptr;
+
+public:
+  static constexpr std::size_t max_capacity =
+      details::compact_arena_registry::granularity
+      << details::compact_arena_registry::offset_bits;
+
+  explicit compact_arena(std::size_t capacity) : capacity_(capacity) {
+    if (capacity > max_capacity) {
+      throw std::bad_alloc{};
+    }
+    data_ = static_cast<std::byte*>(::operator new(capacity));
+    for (id_ = 1u; id_ < details::compact_arena_registry::max_arenas; ++id_) {
+      compact_arena* expected = nullptr;
+      if (details::compact_arena_registry::arenas[id_].compare_exchange_strong(
+              expected, this, std::memory_order::acquire)) {
+        details::compact_arena_registry::bases[id_].store(
+            data_, std::memory_order::release);
+        return;
+      }
+    }
+    ::operator delete(data_);
+    throw std::bad_alloc{}; // Too many live arenas
+  }
+  compact_arena(const compact_arena&) = delete;
+  compact_arena& operator=(const compact_arena&) = delete;
+  ~compact_arena() {
+    // Released before the memory is freed, so that the identifier never
+    // refers to freed memory
+    details::compact_arena_registry::bases[id_].store(
+        nullptr, std::memory_order::relaxed);
+    details::compact_arena_registry::arenas[id_].store(
+        nullptr, std::memory_order::release);
+    ::operator delete(data_);
+  }
+
+  std::size_t capacity() const noexcept { return capacity_; }
+  std::size_t size() const noexcept { return size_; }
+
+private:
+  std::uint32_t allocate(std::size_t size) {
+    constexpr std::size_t granularity =
+        details::compact_arena_registry::granularity;
+    size = (size + granularity - 1u) / granularity * granularity;
+    if (size > capacity_ - size_) {
+      throw std::bad_alloc{};
+    }
+    std::uint32_t result = static_cast<std::uint32_t>(
+        (id_ << details::compact_arena_registry::offset_bits) |
+        (size_ / granularity));
+    size_ += size;
+    return result;
+  }
+
+  std::byte* data_;
+  std::size_t size_ = 0u;
+  std::size_t capacity_;
+  std::uint32_t id_;
+};
+
+template <class T>
+template <class... Args>
+details::arena_ptr<T>::arena_ptr(compact_arena& arena, Args&&... args)
+    : value_(arena.allocate(sizeof(T))) {
+  std::construct_at(reinterpret_cast<T*>(address()),
+                    std::forward<Args>(args)...);
+}
+template <class T>
+details::arena_ptr<T>::arena_ptr(const arena_ptr& rhs)
+  requires(std::is_copy_constructible_v<T>)
+    : arena_ptr(*compact_arena_registry::arenas[rhs.value_ >>
+                                                compact_arena_registry::
+                                                    offset_bits]
+                     .load(std::memory_order::relaxed),
+                *rhs) {}
+
+template <class T>
+struct is_bitwise_trivially_relocatable<details::arena_ptr<T>>
+    : std::true_type {};
+
+template <facade F, class T, class... Args>
+proxy<F> make_proxy_in(compact_arena& arena, Args&&... args)
   requires(std::is_constructible_v<T, Args...>)
 {
-  return details::allocate_proxy_shared_impl<F, T>(alloc,
-                                                   std::forward<Args>(args)...);
+  return proxy<F>{std::in_place_type<details::arena_ptr<T>>, arena,
+                  std::forward<Args>(args)...};
 }
-template <facade F, class T, class Alloc, class U, class... Args>
-constexpr proxy<F> allocate_proxy_shared(const Alloc& alloc,
-                                         std::initializer_list<U> il,
-                                         Args&&... args)
+template <facade F, class T, class U, class... Args>
+proxy<F> make_proxy_in(compact_arena& arena, std::initializer_list<U> il,
+                       Args&&... args)
   requires(std::is_constructible_v<T, std::initializer_list<U>&, Args...>)
 {
-  return details::allocate_proxy_shared_impl<F, T>(alloc, il,
-                                                   std::forward<Args>(args)...);
+  return proxy<F>{std::in_place_type<details::arena_ptr<T>>, arena, il,
+                  std::forward<Args>(args)...};
 }
-template <facade F, class Alloc, class T>
-constexpr proxy<F> allocate_proxy_shared(const Alloc& alloc, T&& value)
+template <facade F, class T>
+proxy<F> make_proxy_in(compact_arena& arena, T&& value)
   requires(std::is_constructible_v<std::decay_t<T>, T>)
 {
-  return details::allocate_proxy_shared_impl<F, std::decay_t<T>>(
-      alloc, std::forward<T>(value));
+  return proxy<F>{std::in_place_type<details::arena_ptr<std::decay_t<T>>>,
+                  arena, std::forward<T>(value)};
 }
+
+// Chunks are aligned to their size, so that the arena owning an object can be
+// found from the address of the object alone.
+class proxy_arena {
+  template <class T>
+  friend class details::proxy_arena_ptr;
+
+public:
+  static constexpr std::size_t chunk_size = std::size_t{1} << 16;
+
+  proxy_arena() noexcept = default;
+  proxy_arena(const proxy_arena&) = delete;
+  proxy_arena& operator=(const proxy_arena&) = delete;
+  ~proxy_arena() { release(); }
+
+  void release() noexcept {
+    while (chunks_ != nullptr) {
+      chunk_header* next = chunks_->next;
+      ::operator delete(chunks_, std::align_val_t{chunk_size});
+      chunks_ = next;
+    }
+    top_ = end_ = 0u;
+    size_ = 0u;
+  }
+  std::size_t size() const noexcept { return size_; }
+
+private:
+  struct chunk_header {
+    proxy_arena* owner;
+    chunk_header* next;
+  };
+
+  static proxy_arena& owner_of(const void* p) noexcept {
+    return *reinterpret_cast<const chunk_header*>(
+                reinterpret_cast<std::uintptr_t>(p) & ~(chunk_size - 1u))
+                ->owner;
+  }
+  void* allocate(std::size_t size, std::size_t align) {
+    std::uintptr_t result = (top_ + align - 1u) & ~(align - 1u);
+    if (result + size > end_) [[unlikely]] {
+      void* chunk_result = allocate_chunk(size, align);
+      size_ += size;
+      return chunk_result;
+    }
+    top_ = result + size;
+    size_ += size;
+    return reinterpret_cast<void*>(result);
+  }
+  void* allocate_chunk(std::size_t size, std::size_t align) {
+    std::size_t offset = (sizeof(chunk_header) + align - 1u) & ~(align - 1u);
+    if (size > chunk_size - offset) {
+      // Values that do not fit in a chunk get a dedicated one, leaving the
+      // current chunk open for smaller values.
+      return add_chunk(offset + size) + offset;
+    }
+    std::byte* chunk = add_chunk(chunk_size);
+    top_ = reinterpret_cast<std::uintptr_t>(chunk) + offset + size;
+    end_ = reinterpret_cast<std::uintptr_t>(chunk) + chunk_size;
+    return chunk + offset;
+  }
+  std::byte* add_chunk(std::size_t size) {
+    void* chunk = ::operator new(size, std::align_val_t{chunk_size});
+    chunks_ = ::new (chunk) chunk_header{this, chunks_};
+    return static_cast<std::byte*>(chunk);
+  }
+
+  chunk_header* chunks_ = nullptr;
+  std::uintptr_t top_ = 0u;
+  std::uintptr_t end_ = 0u;
+  std::size_t size_ = 0u;
+};
+
+template <class T>
+template <class... Args>
+details::proxy_arena_ptr<T>::proxy_arena_ptr(proxy_arena& arena,
+                                             Args&&... args)
+    : ptr_(std::construct_at(
+          static_cast<T*>(arena.allocate(sizeof(T), alignof(T))),
+          std::forward<Args>(args)...)) {}
+template <class T>
+details::proxy_arena_ptr<T>::proxy_arena_ptr(const proxy_arena_ptr& rhs)
+  requires(std::is_copy_constructible_v<T>)
+    : proxy_arena_ptr(proxy_arena::owner_of(rhs.ptr_), *rhs) {}
+
+template <class T>
+struct is_bitwise_trivially_relocatable<details::proxy_arena_ptr<T>>
+    : std::true_type {};
+
 template <facade F, class T, class... Args>
-constexpr proxy<F> make_proxy_shared(Args&&... args)
+proxy<F> make_proxy_in(proxy_arena& arena, Args&&... args)
   requires(std::is_constructible_v<T, Args...>)
 {
-  return details::make_proxy_shared_impl<F, T>(std::forward<Args>(args)...);
+  return proxy<F>{std::in_place_type<details::proxy_arena_ptr<T>>, arena,
+                  std::forward<Args>(args)...};
 }
 template <facade F, class T, class U, class... Args>
-constexpr proxy<F> make_proxy_shared(std::initializer_list<U> il,
-                                     Args&&... args)
+proxy<F> make_proxy_in(proxy_arena& arena, std::initializer_list<U> il,
+                       Args&&... args)
   requires(std::is_constructible_v<T, std::initializer_list<U>&, Args...>)
 {
-  return details::make_proxy_shared_impl<F, T>(il, std::forward<Args>(args)...);
+  return proxy<F>{std::in_place_type<details::proxy_arena_ptr<T>>, arena, il,
+                  std::forward<Args>(args)...};
 }
 template <facade F, class T>
-constexpr proxy<F> make_proxy_shared(T&& value)
+proxy<F> make_proxy_in(proxy_arena& arena, T&& value)
   requires(std::is_constructible_v<std::decay_t<T>, T>)
 {
-  return details::make_proxy_shared_impl<F, std::decay_t<T>>(
-      std::forward<T>(value));
+  return proxy<F>{
+      std::in_place_type<details::proxy_arena_ptr<std::decay_t<T>>>, arena,
+      std::forward<T>(value)};
 }
 #endif // __STDC_HOSTED__
 
@@ -2019,6 +5034,20 @@ struct basic_facade_builder {
   template <class D, details::extended_overload... Os>
     requires(sizeof...(Os) > 0u)
   using add_convention = add_indirect_convention<D, Os...>;
+  template <class D, details::extended_overload... Os>
+    requires(sizeof...(Os) > 0u)
+  using add_hot_indirect_convention =
+      typename add_indirect_convention<D, Os...>::
+          template add_direct_reflection<details::hot_conv_reflector<
+              details::conv_impl<false, D, Os...>>>;
+  template <class D, details::extended_overload... Os>
+    requires(sizeof...(Os) > 0u)
+  using add_hot_direct_convention =
+      typename add_direct_convention<D, Os...>::template add_direct_reflection<
+          details::hot_conv_reflector<details::conv_impl<true, D, Os...>>>;
+  template <class D, details::extended_overload... Os>
+    requires(sizeof...(Os) > 0u)
+  using add_hot_convention = add_hot_indirect_convention<D, Os...>;
   template <class R>
   using add_indirect_reflection = basic_facade_builder<
       Cs, details::add_tuple_t<Rs, details::refl_impl<false, R>>, MaxSize,
@@ -2045,6 +5074,11 @@ struct basic_facade_builder {
       basic_facade_builder<Cs, Rs, details::merge_size(MaxSize, PtrSize),
                            details::merge_size(MaxAlign, PtrAlign), Copyability,
                            Relocatability, Destructibility>;
+  template <std::size_t Size, std::size_t Align = details::max_align_of(Size)>
+    requires(details::is_layout_well_formed(Size, Align))
+  using small_buffer =
+      basic_facade_builder<Cs, Rs, Size, Align, Copyability, Relocatability,
+                           Destructibility>;
   template <constraint_level CL>
     requires(details::is_cl_well_formed(CL))
   using support_copy =
@@ -2063,8 +5097,12 @@ struct basic_facade_builder {
       basic_facade_builder<Cs, Rs, MaxSize, MaxAlign, Copyability,
                            Relocatability,
                            details::merge_constraint(Destructibility, CL)>;
-  template <template <class> class Skill>
-  using add_skill = Skill<basic_facade_builder>;
+  template <std::size_t N>
+    requires(N > 0u)
+  using inline_meta =
+      add_direct_reflection<details::inline_meta_reflector<N>>;
+  template <template <class, class...> class Skill, class... Args>
+  using add_skill = Skill<basic_facade_builder, Args...>;
   using build = details::facade_impl<
       Cs, Rs,
       MaxSize == details::invalid_size ? sizeof(details::ptr_prototype)
@@ -2224,54 +5262,417 @@ struct proxy_cast_accessor_impl {
   }
 };
 
-#define PROD_DEF_PROXY_CAST_ACCESSOR(oq, pq, ne, ...)                          \
-  template <class P, class D>                                                  \
-  struct accessor<P, D, void(proxy_cast_context) oq ne>                        \
-      : proxy_cast_accessor_impl<P pq, D, void(proxy_cast_context) oq ne> {}
-struct proxy_cast_dispatch {
-  template <class T>
-  PRO4D_STATIC_CALL(void, T&& self, proxy_cast_context ctx) {
-    if (typeid(T) == *ctx.type_ptr) [[likely]] {
-      if (ctx.is_ref) {
-        if constexpr (std::is_lvalue_reference_v<T>) {
-          if (ctx.is_const || !std::is_const_v<T>) [[likely]] {
-            *static_cast<void**>(ctx.result_ptr) = (void*)std::addressof(self);
-          }
-        }
-      } else {
-        if constexpr (std::is_constructible_v<std::decay_t<T>, T>) {
-          static_cast<std::optional<std::decay_t<T>>*>(ctx.result_ptr)
-              ->emplace(std::forward<T>(self));
-        }
+#define PROD_DEF_PROXY_CAST_ACCESSOR(oq, pq, ne, ...)                          \
+  template <class P, class D>                                                  \
+  struct accessor<P, D, void(proxy_cast_context) oq ne>                        \
+      : proxy_cast_accessor_impl<P pq, D, void(proxy_cast_context) oq ne> {}
+struct proxy_cast_dispatch {
+  template <class T>
+  PRO4D_STATIC_CALL(void, T&& self, proxy_cast_context ctx) {
+    if (typeid(T) == *ctx.type_ptr) [[likely]] {
+      if (ctx.is_ref) {
+        if constexpr (std::is_lvalue_reference_v<T>) {
+          if (ctx.is_const || !std::is_const_v<T>) [[likely]] {
+            *static_cast<void**>(ctx.result_ptr) = (void*)std::addressof(self);
+          }
+        }
+      } else {
+        if constexpr (std::is_constructible_v<std::decay_t<T>, T>) {
+          static_cast<std::optional<std::decay_t<T>>*>(ctx.result_ptr)
+              ->emplace(std::forward<T>(self));
+        }
+      }
+    }
+  }
+  PRO4D_DEF_ACCESSOR_TEMPLATE(FREE, PROD_DEF_PROXY_CAST_ACCESSOR)
+};
+#undef PROD_DEF_PROXY_CAST_ACCESSOR
+
+struct proxy_typeid_reflector {
+  proxy_typeid_reflector() = default;
+  template <class T>
+  constexpr explicit proxy_typeid_reflector(std::in_place_type_t<T>)
+      : info(&typeid(T)) {}
+
+  template <class Self, class R>
+  struct accessor {
+    friend const std::type_info& proxy_typeid(const Self& self) noexcept {
+      const proxy_typeid_reflector& refl = proxy_reflect<R>(self);
+      return *refl.info;
+    }
+    PRO4D_DEBUG(
+        accessor() noexcept { std::ignore = &pro_symbol_guard; }
+
+        private : static inline const std::type_info& pro_symbol_guard(
+            const Self& self) { return proxy_typeid(self); })
+  };
+
+  const std::type_info* info;
+};
+#endif // __cpp_rtti >= 199711L
+
+template <class... Ts>
+struct speculation_reflector {
+  speculation_reflector() = default;
+  template <class P>
+  constexpr explicit speculation_reflector(std::in_place_type_t<P>) noexcept {}
+};
+
+template <class T>
+struct speculation_type_list : std::type_identity<std::tuple<T>> {};
+template <class... Ts>
+struct speculation_type_list<std::tuple<Ts...>>
+    : std::type_identity<std::tuple<Ts...>> {};
+template <class R>
+struct speculation_refl_traits : std::type_identity<void> {};
+template <class... Ts>
+struct speculation_refl_traits<speculation_reflector<Ts...>>
+    : std::type_identity<composite_t<
+          std::tuple<>, typename speculation_type_list<Ts>::type...>> {};
+template <class... Rs>
+using speculated_types_t =
+    composite_t<std::tuple<>, typename speculation_refl_traits<
+                                  typename Rs::reflector_type>::type...>;
+
+// A speculated type is either a pointer type, or a value type that is mapped
+// to the pointer type make_proxy would create for it.
+template <class T, class F>
+struct speculated_ptr_traits : std::type_identity<void> {};
+template <class T, class F>
+  requires(proxiable<T, F>)
+struct speculated_ptr_traits<T, F> : std::type_identity<std::tuple<T>> {};
+template <class T, class F>
+  requires(!proxiable<T, F> && proxiable<inplace_ptr<T>, F>)
+struct speculated_ptr_traits<T, F>
+    : std::type_identity<std::tuple<inplace_ptr<T>>> {};
+#if __STDC_HOSTED__
+template <class T, class F>
+  requires(!proxiable<T, F> && !proxiable<inplace_ptr<T>, F> &&
+           proxiable<allocated_ptr_t<F, T, default_alloc_t<F>>, F>)
+struct speculated_ptr_traits<T, F>
+    : std::type_identity<
+          std::tuple<allocated_ptr_t<F, T, default_alloc_t<F>>>> {};
+template <class T, class F>
+  requires(!proxiable<T, F> && !proxiable<inplace_ptr<T>, F> &&
+           !proxiable<allocated_ptr_t<F, T, default_alloc_t<F>>, F> &&
+           proxiable<compact_ptr<T, default_alloc_t<F>>, F>)
+struct speculated_ptr_traits<T, F>
+    : std::type_identity<std::tuple<compact_ptr<T, default_alloc_t<F>>>> {};
+#endif // __STDC_HOSTED__
+template <class F, class... Ts>
+using speculated_ptrs_t =
+    composite_t<std::tuple<>, typename speculated_ptr_traits<Ts, F>::type...>;
+
+template <class F, bool IsDirect, class D, class O, class P, class... Args>
+decltype(auto) speculative_invoke(std::tuple<>*, P&& p, Args&&... args) {
+  auto dispatcher =
+      proxy_helper::get_invocation_meta<IsDirect, D, O>(p).dispatcher;
+  return dispatcher(
+      overload_traits<O>::template dispatcher_operand<F, IsDirect>(
+          std::forward<P>(p)),
+      std::forward<Args>(args)...);
+}
+template <class F, bool IsDirect, class D, class O, class SP, class... SPs,
+          class P, class... Args>
+decltype(auto) speculative_invoke(std::tuple<SP, SPs...>*, P&& p,
+                                  Args&&... args) {
+  if (proxy_helper::is_meta_of<SP>(p)) {
+    // Calls the dispatcher of SP directly so that it can be inlined
+    return overload_traits<O>::template dispatcher<SP, F, IsDirect, D>(
+        overload_traits<O>::template dispatcher_operand<F, IsDirect>(
+            std::forward<P>(p)),
+        std::forward<Args>(args)...);
+  }
+  return speculative_invoke<F, IsDirect, D, O>(
+      static_cast<std::tuple<SPs...>*>(nullptr), std::forward<P>(p),
+      std::forward<Args>(args)...);
+}
+
+#if __STDC_HOSTED__
+template <class T>
+consteval const char* type_name_probe() noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+  return __FUNCSIG__;
+#else
+  return __PRETTY_FUNCTION__;
+#endif
+}
+consteval std::size_t cstr_size(const char* s) noexcept {
+  std::size_t result = 0u;
+  while (s[result] != '\0') {
+    ++result;
+  }
+  return result;
+}
+consteval bool cstr_starts_with(const char* s, const char* prefix) noexcept {
+  for (; *prefix != '\0'; ++s, ++prefix) {
+    if (*s != *prefix) {
+      return false;
+    }
+  }
+  return true;
+}
+struct type_name_span {
+  std::size_t begin;
+  std::size_t size;
+};
+// Locates the spelling of T in the signature of type_name_probe<T>, using
+// type_name_probe<double> to learn the compiler-specific prefix and suffix.
+template <class T>
+consteval type_name_span get_type_name_span() noexcept {
+  const char* probe = type_name_probe<double>();
+  std::size_t prefix = 0u;
+  while (!cstr_starts_with(probe + prefix, "double")) {
+    ++prefix;
+  }
+  std::size_t suffix = cstr_size(probe) - prefix - cstr_size("double");
+  const char* s = type_name_probe<T>();
+  std::size_t begin = prefix, end = cstr_size(s) - suffix;
+  for (const char* keyword : {"struct ", "class ", "union ", "enum "}) {
+    if (cstr_starts_with(s + begin, keyword)) {
+      begin += cstr_size(keyword);
+      break;
+    }
+  }
+  return {begin, end - begin};
+}
+// Whether a spelling refers to a type that can be named outside of the
+// function that spells it, i.e., it does not involve an unnamed namespace, a
+// closure type, an unnamed type, or a local type, as spelled by GCC, Clang
+// and MSVC.
+consteval bool is_nameable_type_name(const char* s, std::size_t size) noexcept {
+  for (std::size_t i = 0; i < size; ++i) {
+    if (s[i] == '`' || cstr_starts_with(s + i, ")::")) {
+      return false;
+    }
+    if (s[i] == '(' || s[i] == '{' || s[i] == '<') {
+      for (const char* keyword : {"anonymous", "lambda", "unnamed"}) {
+        if (cstr_starts_with(s + i + 1, keyword)) {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+template <class T>
+struct type_name_traits {
+  static constexpr type_name_span span = get_type_name_span<T>();
+  static constexpr bool is_nameable =
+      is_nameable_type_name(type_name_probe<T>() + span.begin, span.size);
+  struct storage_type {
+    char value[span.size + 1u];
+  };
+  static constexpr storage_type storage = [] {
+    storage_type result{};
+    const char* s = type_name_probe<T>();
+    for (std::size_t i = 0; i < span.size; ++i) {
+      result.value[i] = s[span.begin + i];
+    }
+    return result;
+  }();
+};
+template <class T>
+inline constexpr const char* type_name_v = type_name_traits<T>::storage.value;
+
+struct speculation_type_info {
+  const char* name;
+  bool is_speculatable;
+};
+template <class P>
+struct speculation_name_traits : std::type_identity<P> {
+  static constexpr bool is_speculatable = true;
+};
+template <class P>
+struct unspeculatable_name_traits : std::type_identity<P> {
+  static constexpr bool is_speculatable = false;
+};
+template <class T>
+struct speculation_name_traits<inplace_ptr<T>> : speculation_name_traits<T> {};
+template <class T, class Alloc>
+struct speculation_name_traits<allocated_ptr<T, Alloc>>
+    : unspeculatable_name_traits<allocated_ptr<T, Alloc>> {};
+template <class T>
+struct speculation_name_traits<allocated_ptr<T, std::allocator<void>>>
+    : speculation_name_traits<T> {};
+template <class T, class Alloc>
+struct speculation_name_traits<compact_ptr<T, Alloc>>
+    : unspeculatable_name_traits<compact_ptr<T, Alloc>> {};
+template <class T>
+struct speculation_name_traits<compact_ptr<T, std::allocator<void>>>
+    : speculation_name_traits<T> {};
+template <class T>
+struct speculation_name_traits<
+    allocated_ptr<T, thread_caching_allocator<void>>>
+    : speculation_name_traits<T> {};
+template <class T>
+struct speculation_name_traits<compact_ptr<T, thread_caching_allocator<void>>>
+    : speculation_name_traits<T> {};
+template <class T, class Alloc>
+struct speculation_name_traits<cow_ptr<T, Alloc>>
+    : unspeculatable_name_traits<cow_ptr<T, Alloc>> {};
+template <class T>
+struct speculation_name_traits<cow_ptr<T, std::allocator<void>>>
+    : speculation_name_traits<T> {};
+template <class T>
+struct speculation_name_traits<cow_ptr<T, thread_caching_allocator<void>>>
+    : speculation_name_traits<T> {};
+template <class T, class Alloc, class RC>
+struct speculation_name_traits<shared_compact_ptr<T, Alloc, RC>>
+    : unspeculatable_name_traits<shared_compact_ptr<T, Alloc, RC>> {};
+template <class T, class Alloc, class RC>
+struct speculation_name_traits<strong_compact_ptr<T, Alloc, RC>>
+    : unspeculatable_name_traits<strong_compact_ptr<T, Alloc, RC>> {};
+template <class T, class Alloc, class RC>
+struct speculation_name_traits<weak_compact_ptr<T, Alloc, RC>>
+    : unspeculatable_name_traits<weak_compact_ptr<T, Alloc, RC>> {};
+template <class LR, class CLR, class RR, class CRR>
+struct speculation_name_traits<observer_ptr<LR, CLR, RR, CRR>>
+    : unspeculatable_name_traits<observer_ptr<LR, CLR, RR, CRR>> {};
+template <class P>
+inline constexpr speculation_type_info speculation_type_info_v{
+    type_name_v<typename speculation_name_traits<P>::type>,
+    speculation_name_traits<P>::is_speculatable &&
+        type_name_traits<typename speculation_name_traits<P>::type>::
+            is_nameable};
+
+struct speculation_profiler {
+  speculation_profiler() = default;
+  template <class P>
+  constexpr explicit speculation_profiler(std::in_place_type_t<P>) noexcept
+      : info(&speculation_type_info_v<P>) {}
+
+  const speculation_type_info* info;
+};
+
+// Call counts of a convention, with one slot for each of the first few types
+// observed. Sites are registered into a lock-free list on their first call.
+struct speculation_site {
+  static constexpr std::size_t slot_count = 8u;
+  struct slot {
+    std::atomic<const speculation_type_info*> type{nullptr};
+    std::atomic<std::uint64_t> count{0u};
+  };
+
+  constexpr speculation_site(const char* facade, const char* dispatch,
+                             const char* overload) noexcept
+      : facade(facade), dispatch(dispatch), overload(overload) {}
+
+  void record(const speculation_type_info* type) noexcept;
+
+  const char* facade;
+  const char* dispatch;
+  const char* overload;
+  slot slots[slot_count];
+  std::atomic<std::uint64_t> others{0u};
+  std::atomic<bool> registered{false};
+  speculation_site* next = nullptr;
+};
+inline std::atomic<speculation_site*> speculation_site_head{nullptr};
+inline void speculation_site::record(
+    const speculation_type_info* type) noexcept {
+  if (!registered.load(std::memory_order::acquire)) [[unlikely]] {
+    if (!registered.exchange(true, std::memory_order::acq_rel)) {
+      next = speculation_site_head.load(std::memory_order::relaxed);
+      while (!speculation_site_head.compare_exchange_weak(
+          next, this, std::memory_order::release, std::memory_order::relaxed)) {
       }
     }
   }
-  PRO4D_DEF_ACCESSOR_TEMPLATE(FREE, PROD_DEF_PROXY_CAST_ACCESSOR)
-};
-#undef PROD_DEF_PROXY_CAST_ACCESSOR
-
-struct proxy_typeid_reflector {
-  proxy_typeid_reflector() = default;
-  template <class T>
-  constexpr explicit proxy_typeid_reflector(std::in_place_type_t<T>)
-      : info(&typeid(T)) {}
+  for (slot& s : slots) {
+    const speculation_type_info* current =
+        s.type.load(std::memory_order::relaxed);
+    if (current == nullptr &&
+        s.type.compare_exchange_strong(current, type,
+                                       std::memory_order::relaxed)) {
+      current = type;
+    }
+    if (current == type) {
+      s.count.fetch_add(1u, std::memory_order::relaxed);
+      return;
+    }
+  }
+  others.fetch_add(1u, std::memory_order::relaxed);
+}
+template <class F, bool IsDirect, class D, class O>
+inline speculation_site speculation_site_v{type_name_v<F>, type_name_v<D>,
+                                           type_name_v<O>};
 
-  template <class Self, class R>
-  struct accessor {
-    friend const std::type_info& proxy_typeid(const Self& self) noexcept {
-      const proxy_typeid_reflector& refl = proxy_reflect<R>(self);
-      return *refl.info;
+struct speculation_entry {
+  const speculation_type_info* type;
+  std::uint64_t count;
+};
+inline void sort_speculation_entries(std::vector<speculation_entry>& e) {
+  for (std::size_t i = 1; i < e.size(); ++i) {
+    for (std::size_t j = i; j > 0 && e[j - 1u].count < e[j].count; --j) {
+      std::swap(e[j - 1u], e[j]);
     }
-    PRO4D_DEBUG(
-        accessor() noexcept { std::ignore = &pro_symbol_guard; }
+  }
+}
+template <class OutIt>
+OutIt write_cstr(OutIt out, const char* s) {
+  for (; *s != '\0'; ++s) {
+    *out = *s;
+    ++out;
+  }
+  return out;
+}
+template <class OutIt>
+OutIt write_uint(OutIt out, std::uint64_t value) {
+  char buffer[20];
+  std::size_t size = 0u;
+  do {
+    buffer[size++] = static_cast<char>('0' + value % 10u);
+    value /= 10u;
+  } while (value != 0u);
+  while (size > 0u) {
+    *out = buffer[--size];
+    ++out;
+  }
+  return out;
+}
+template <class OutIt>
+OutIt write_identifier(OutIt out, const char* s) {
+  for (; *s != '\0'; ++s) {
+    bool alnum = (*s >= '0' && *s <= '9') || (*s >= 'a' && *s <= 'z') ||
+                 (*s >= 'A' && *s <= 'Z');
+    *out = alnum ? *s : '_';
+    ++out;
+  }
+  return out;
+}
+#endif // __STDC_HOSTED__
 
-        private : static inline const std::type_info& pro_symbol_guard(
-            const Self& self) { return proxy_typeid(self); })
-  };
+template <class F>
+struct speculation_traits {
+  using ptr_types =
+      instantiated_t<speculated_ptrs_t,
+                     instantiated_t<speculated_types_t,
+                                    typename F::reflection_types>,
+                     F>;
+#if __STDC_HOSTED__
+  static constexpr bool is_profiling =
+      std::is_base_of_v<refl_meta<true, speculation_profiler>,
+                        typename facade_traits<F>::meta>;
+#else
+  static constexpr bool is_profiling = false;
+#endif // __STDC_HOSTED__
+  static constexpr bool applicable =
+      is_profiling || std::tuple_size_v<ptr_types> > 0u;
 
-  const std::type_info* info;
+  template <bool IsDirect, class D, class O, class P, class... Args>
+  static decltype(auto) invoke(P&& p, Args&&... args) {
+#if __STDC_HOSTED__
+    if constexpr (is_profiling) {
+      speculation_site_v<F, IsDirect, D, O>.record(
+          proxy_reflect<speculation_profiler>(std::as_const(p)).info);
+    }
+#endif // __STDC_HOSTED__
+    return speculative_invoke<F, IsDirect, D, O>(
+        static_cast<ptr_types*>(nullptr), std::forward<P>(p),
+        std::forward<Args>(args)...);
+  }
 };
-#endif // __cpp_rtti >= 199711L
 
 } // namespace details
 
@@ -2322,8 +5723,174 @@ using as_weak = typename FB::template add_direct_convention<
     details::weak_conversion_dispatch,
     facade_aware_overload_t<details::weak_conversion_overload>>;
 
+#if __STDC_HOSTED__
+template <class FB>
+using compact = typename FB::template restrict_layout<
+    sizeof(std::uint32_t), alignof(std::uint32_t)>::
+    template add_direct_reflection<details::compact_meta_reflector>;
+#endif // __STDC_HOSTED__
+
+#if __STDC_HOSTED__
+template <class FB>
+using tagged = typename slim<FB>::template add_direct_reflection<
+    details::tagged_meta_reflector>;
+#endif // __STDC_HOSTED__
+
+#if __STDC_HOSTED__
+template <class FB>
+using pooled_meta = typename FB::template add_direct_reflection<
+    details::pooled_meta_reflector>;
+#endif // __STDC_HOSTED__
+
+#if __STDC_HOSTED__
+template <class FB>
+using thread_caching = typename FB::template add_direct_reflection<
+    details::thread_caching_reflector>;
+#endif // __STDC_HOSTED__
+
+#if __STDC_HOSTED__
+template <class FB>
+using cow =
+    typename FB::template add_direct_reflection<details::cow_reflector>;
+#endif // __STDC_HOSTED__
+
+#if __STDC_HOSTED__
+template <class FB>
+using shared_ownership = typename FB::template add_direct_reflection<
+    details::shared_ownership_reflector>;
+#endif // __STDC_HOSTED__
+
+template <class FB>
+using stateless = typename slim<FB>::template add_direct_reflection<
+    details::stateless_meta_reflector>;
+
+template <class FB>
+using in_place_assignment = typename FB::template add_direct_reflection<
+    details::in_place_assignment_reflector>;
+
+template <class FB>
+using register_dispatch = typename FB::template add_direct_reflection<
+    details::register_dispatch_reflector>;
+
+template <class FB>
+using shared_meta =
+    typename FB::template add_direct_reflection<details::shared_meta_reflector>;
+
+template <class FB, class... Ts>
+using speculate = typename FB::template add_direct_reflection<
+    details::speculation_reflector<Ts...>>;
+
+#if __STDC_HOSTED__
+template <class FB>
+using profile_speculation =
+    typename FB::template add_direct_reflection<details::speculation_profiler>;
+#endif // __STDC_HOSTED__
+
 } // namespace skills
 
+#if __STDC_HOSTED__
+template <class OutIt>
+OutIt write_speculation_profile(OutIt out) {
+  using details::write_cstr;
+  std::vector<const details::speculation_site*> sites;
+  for (const details::speculation_site* site =
+           details::speculation_site_head.load(std::memory_order::acquire);
+       site != nullptr; site = site->next) {
+    sites.push_back(site);
+  }
+  out = write_cstr(std::move(out), "// Generated by "
+                                   "pro::write_speculation_profile.\n"
+                                   "#pragma once\n\n#include <tuple>\n");
+  for (std::size_t i = 0; i < sites.size(); ++i) {
+    const char* facade = sites[i]->facade;
+    bool visited = false;
+    for (std::size_t j = 0; j < i; ++j) {
+      visited |= sites[j]->facade == facade;
+    }
+    if (visited) {
+      continue;
+    }
+    std::vector<details::speculation_entry> totals;
+    std::uint64_t total = 0u;
+    out = write_cstr(std::move(out), "\n// ");
+    out = write_cstr(std::move(out), facade);
+    out = write_cstr(std::move(out), "\n");
+    for (std::size_t j = i; j < sites.size(); ++j) {
+      const details::speculation_site& site = *sites[j];
+      if (site.facade != facade) {
+        continue;
+      }
+      std::vector<details::speculation_entry> entries;
+      for (const auto& s : site.slots) {
+        const details::speculation_type_info* type =
+            s.type.load(std::memory_order::relaxed);
+        if (type != nullptr) {
+          entries.push_back({type, s.count.load(std::memory_order::relaxed)});
+        }
+      }
+      details::sort_speculation_entries(entries);
+      out = write_cstr(std::move(out), "//   ");
+      out = write_cstr(std::move(out), site.dispatch);
+      out = write_cstr(std::move(out), ", ");
+      out = write_cstr(std::move(out), site.overload);
+      out = write_cstr(std::move(out), ":");
+      const char* separator = " ";
+      for (const details::speculation_entry& entry : entries) {
+        out = write_cstr(std::move(out), separator);
+        separator = ", ";
+        out = write_cstr(std::move(out), entry.type->name);
+        out = write_cstr(std::move(out), " (");
+        out = details::write_uint(std::move(out), entry.count);
+        out = write_cstr(std::move(out), ")");
+        total += entry.count;
+        bool merged = false;
+        for (details::speculation_entry& t : totals) {
+          if (t.type == entry.type) {
+            t.count += entry.count;
+            merged = true;
+          }
+        }
+        if (!merged) {
+          totals.push_back(entry);
+        }
+      }
+      std::uint64_t others = site.others.load(std::memory_order::relaxed);
+      if (others != 0u) {
+        out = write_cstr(std::move(out), separator);
+        out = write_cstr(std::move(out), "others (");
+        out = details::write_uint(std::move(out), others);
+        out = write_cstr(std::move(out), ")");
+        total += others;
+      }
+      out = write_cstr(std::move(out), "\n");
+    }
+
+    // The type list covers 95% of the calls with at most 3 types
+    details::sort_speculation_entries(totals);
+    out = write_cstr(std::move(out), "using ");
+    out = details::write_identifier(std::move(out), facade);
+    out = write_cstr(std::move(out), "_speculation = std::tuple<");
+    std::uint64_t covered = 0u;
+    std::size_t count = 0u;
+    for (const details::speculation_entry& entry : totals) {
+      if (count == 3u || covered * 100u >= total * 95u) {
+        break;
+      }
+      if (entry.type->is_speculatable) {
+        if (count != 0u) {
+          out = write_cstr(std::move(out), ", ");
+        }
+        out = write_cstr(std::move(out), entry.type->name);
+        covered += entry.count;
+        ++count;
+      }
+    }
+    out = write_cstr(std::move(out), ">;\n");
+  }
+  return out;
+}
+#endif // __STDC_HOSTED__
+
 // =============================================================================
 // == Dispatch Extensions (operator_dispatch, weak_dispatch, etc.)            ==
 // =============================================================================
@@ -2602,6 +6169,439 @@ struct weak_dispatch : D {
   }
 };
 
+#if __STDC_HOSTED__
+// =============================================================================
+// == Containers (grouped_proxy_vector, proxy_vector, proxy_soa)              ==
+// =============================================================================
+
+template <facade F>
+  requires(std::is_move_constructible_v<proxy<F>>)
+class grouped_proxy_vector {
+  using group_storage = std::vector<proxy<F>>;
+
+  template <bool IsConst>
+  class iterator_impl {
+    friend class grouped_proxy_vector;
+    using group_ptr =
+        std::conditional_t<IsConst, const group_storage*, group_storage*>;
+
+    iterator_impl(group_ptr group, std::size_t index) noexcept
+        : group_(group), index_(index) {}
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = proxy<F>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<IsConst, const proxy<F>*, proxy<F>*>;
+    using reference = std::conditional_t<IsConst, const proxy<F>&, proxy<F>&>;
+
+    iterator_impl() = default;
+    iterator_impl(const iterator_impl<false>& rhs) noexcept
+      requires(IsConst)
+        : group_(rhs.group_), index_(rhs.index_) {}
+
+    reference operator*() const noexcept { return (*group_)[index_]; }
+    pointer operator->() const noexcept { return std::addressof(**this); }
+    iterator_impl& operator++() noexcept {
+      if (++index_ == group_->size()) {
+        ++group_;
+        index_ = 0u;
+      }
+      return *this;
+    }
+    iterator_impl operator++(int) noexcept {
+      iterator_impl result = *this;
+      ++*this;
+      return result;
+    }
+    friend bool operator==(const iterator_impl&,
+                           const iterator_impl&) noexcept = default;
+
+  private:
+    group_ptr group_ = nullptr;
+    std::size_t index_ = 0u;
+  };
+
+public:
+  using value_type = proxy<F>;
+  using size_type = std::size_t;
+  using iterator = iterator_impl<false>;
+  using const_iterator = iterator_impl<true>;
+
+  grouped_proxy_vector() = default;
+  grouped_proxy_vector(const grouped_proxy_vector&) = default;
+  grouped_proxy_vector(grouped_proxy_vector&&) noexcept = default;
+  grouped_proxy_vector& operator=(const grouped_proxy_vector&) = default;
+  grouped_proxy_vector& operator=(grouped_proxy_vector&&) noexcept = default;
+
+  proxy<F>& insert(proxy<F> p) {
+    assert(p.has_value());
+    group_storage* group = find_group(p);
+    if (group == nullptr) {
+      group_storage fresh;
+      fresh.push_back(std::move(p));
+      group = &groups_.emplace_back(std::move(fresh));
+      last_ = groups_.size() - 1u;
+    } else {
+      group->push_back(std::move(p));
+    }
+    ++size_;
+    return group->back();
+  }
+  void clear() noexcept {
+    groups_.clear();
+    size_ = 0u;
+    last_ = 0u;
+  }
+
+  iterator begin() noexcept { return iterator{groups_.data(), 0u}; }
+  const_iterator begin() const noexcept {
+    return const_iterator{groups_.data(), 0u};
+  }
+  iterator end() noexcept {
+    return iterator{groups_.data() + groups_.size(), 0u};
+  }
+  const_iterator end() const noexcept {
+    return const_iterator{groups_.data() + groups_.size(), 0u};
+  }
+  size_type size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0u; }
+  size_type group_count() const noexcept { return groups_.size(); }
+  std::span<proxy<F>> group(size_type n) noexcept {
+    assert(n < groups_.size());
+    return groups_[n];
+  }
+  std::span<const proxy<F>> group(size_type n) const noexcept {
+    assert(n < groups_.size());
+    return groups_[n];
+  }
+
+private:
+  group_storage* find_group(const proxy<F>& p) noexcept {
+    // Insertions usually come in runs of the same type, so the most recently
+    // used group is checked before scanning the others.
+    if (last_ < groups_.size() &&
+        details::proxy_helper::is_same_meta(groups_[last_].front(), p)) {
+      return &groups_[last_];
+    }
+    for (std::size_t i = 0u; i < groups_.size(); ++i) {
+      if (details::proxy_helper::is_same_meta(groups_[i].front(), p)) {
+        last_ = i;
+        return &groups_[i];
+      }
+    }
+    return nullptr;
+  }
+
+  std::vector<group_storage> groups_;
+  size_type size_ = 0u;
+  size_type last_ = 0u;
+};
+
+template <facade F>
+  requires(F::relocatability >= constraint_level::nothrow &&
+           F::destructibility >= constraint_level::nothrow)
+class proxy_vector {
+  using allocator_type = std::allocator<proxy<F>>;
+
+public:
+  using value_type = proxy<F>;
+  using size_type = std::size_t;
+  using iterator = proxy<F>*;
+  using const_iterator = const proxy<F>*;
+
+  proxy_vector() = default;
+  // Delegates to the default constructor, so that the storage is released if
+  // copying an element throws.
+  proxy_vector(const proxy_vector& rhs)
+    requires(F::copyability != constraint_level::none)
+      : proxy_vector() {
+    reserve(rhs.size_);
+    uninitialized_copy_n(rhs.data_, rhs.size_, data_);
+    size_ = rhs.size_;
+  }
+  proxy_vector(proxy_vector&& rhs) noexcept
+      : data_(std::exchange(rhs.data_, nullptr)),
+        size_(std::exchange(rhs.size_, 0u)),
+        capacity_(std::exchange(rhs.capacity_, 0u)) {}
+  proxy_vector& operator=(const proxy_vector& rhs)
+    requires(F::copyability != constraint_level::none)
+  {
+    if (this != std::addressof(rhs)) [[likely]] {
+      *this = proxy_vector{rhs};
+    }
+    return *this;
+  }
+  proxy_vector& operator=(proxy_vector&& rhs) noexcept {
+    if (this != std::addressof(rhs)) [[likely]] {
+      release();
+      data_ = std::exchange(rhs.data_, nullptr);
+      size_ = std::exchange(rhs.size_, 0u);
+      capacity_ = std::exchange(rhs.capacity_, 0u);
+    }
+    return *this;
+  }
+  ~proxy_vector() { release(); }
+
+  proxy<F>& push_back(proxy<F> p) {
+    if (size_ == capacity_) {
+      reallocate(capacity_ == 0u ? 4u : capacity_ * 2u);
+    }
+    proxy<F>* result = std::construct_at(data_ + size_, std::move(p));
+    ++size_;
+    return *result;
+  }
+  void pop_back() noexcept {
+    assert(size_ != 0u);
+    --size_;
+    destroy_n(data_ + size_, 1u);
+  }
+  void reserve(size_type n) {
+    if (n > capacity_) {
+      reallocate(n);
+    }
+  }
+  void clear() noexcept {
+    destroy_n(data_, size_);
+    size_ = 0u;
+  }
+
+  proxy<F>& operator[](size_type n) noexcept {
+    assert(n < size_);
+    return data_[n];
+  }
+  const proxy<F>& operator[](size_type n) const noexcept {
+    assert(n < size_);
+    return data_[n];
+  }
+  proxy<F>* data() noexcept { return data_; }
+  const proxy<F>* data() const noexcept { return data_; }
+  iterator begin() noexcept { return data_; }
+  const_iterator begin() const noexcept { return data_; }
+  iterator end() noexcept { return data_ + size_; }
+  const_iterator end() const noexcept { return data_ + size_; }
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept { return capacity_; }
+  bool empty() const noexcept { return size_ == 0u; }
+
+private:
+  void reallocate(size_type n) {
+    allocator_type alloc;
+    proxy<F>* data = alloc.allocate(n);
+    uninitialized_relocate_n(data_, size_, data);
+    if (data_ != nullptr) {
+      alloc.deallocate(data_, capacity_);
+    }
+    data_ = data;
+    capacity_ = n;
+  }
+  void release() noexcept {
+    clear();
+    if (data_ != nullptr) {
+      allocator_type{}.deallocate(data_, capacity_);
+      data_ = nullptr;
+      capacity_ = 0u;
+    }
+  }
+
+  proxy<F>* data_ = nullptr;
+  size_type size_ = 0u;
+  size_type capacity_ = 0u;
+};
+
+template <facade F>
+  requires(F::relocatability == constraint_level::trivial)
+class proxy_soa {
+  using meta_ptr = details::facade_meta_ptr<F>;
+  struct slot {
+    alignas(proxy<F>) std::byte data[sizeof(proxy<F>)];
+  };
+
+  // Refers to an element stored in the container, which is invoked and viewed
+  // in place. A reference to a non-const element copies the meta of the
+  // element back to the array of metas when it is destroyed, in case the
+  // element has been modified through it.
+  template <bool IsConst>
+  class reference_impl {
+    friend class proxy_soa;
+    using owner = std::conditional_t<IsConst, const proxy_soa, proxy_soa>;
+
+    reference_impl(owner& soa, std::size_t index) noexcept
+        : soa_(soa), index_(index) {}
+
+    using value_reference =
+        std::conditional_t<IsConst, const proxy<F>&, proxy<F>&>;
+
+  public:
+    reference_impl(const reference_impl&) = delete;
+    ~reference_impl() {
+      if constexpr (!IsConst) {
+        soa_.metas_[index_] =
+            details::proxy_helper::get_meta_ptr(soa_.element(index_));
+      }
+    }
+
+    value_reference operator*() const noexcept { return soa_.element(index_); }
+    value_reference operator->() const noexcept {
+      return soa_.element(index_);
+    }
+
+  private:
+    owner& soa_;
+    std::size_t index_;
+  };
+
+  template <bool IsConst>
+  class iterator_impl {
+    friend class proxy_soa;
+    using owner = std::conditional_t<IsConst, const proxy_soa, proxy_soa>;
+
+    iterator_impl(owner* soa, std::size_t index) noexcept
+        : soa_(soa), index_(index) {}
+
+  public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = proxy<F>;
+    using difference_type = std::ptrdiff_t;
+    using reference = reference_impl<IsConst>;
+
+    iterator_impl() = default;
+    iterator_impl(const iterator_impl<false>& rhs) noexcept
+      requires(IsConst)
+        : soa_(rhs.soa_), index_(rhs.index_) {}
+
+    reference operator*() const noexcept { return reference{*soa_, index_}; }
+    iterator_impl& operator++() noexcept {
+      ++index_;
+      return *this;
+    }
+    iterator_impl operator++(int) noexcept {
+      iterator_impl result = *this;
+      ++*this;
+      return result;
+    }
+    friend bool operator==(const iterator_impl&,
+                           const iterator_impl&) noexcept = default;
+
+  private:
+    owner* soa_ = nullptr;
+    std::size_t index_ = 0u;
+  };
+
+public:
+  using value_type = proxy<F>;
+  using size_type = std::size_t;
+  using reference = reference_impl<false>;
+  using const_reference = reference_impl<true>;
+  using iterator = iterator_impl<false>;
+  using const_iterator = iterator_impl<true>;
+
+  class type_token {
+    friend class proxy_soa;
+
+    explicit type_token(const meta_ptr& meta) noexcept : meta_(meta) {}
+
+  public:
+    friend bool operator==(const type_token&,
+                           const type_token&) noexcept = default;
+
+  private:
+    meta_ptr meta_;
+  };
+
+  proxy_soa() = default;
+  proxy_soa(const proxy_soa& rhs)
+    requires(F::copyability != constraint_level::none)
+  {
+    reserve(rhs.size());
+    for (size_type i = 0u; i < rhs.size(); ++i) {
+      push_back(rhs.element(i));
+    }
+  }
+  proxy_soa(proxy_soa&&) noexcept = default;
+  proxy_soa& operator=(const proxy_soa& rhs)
+    requires(F::copyability != constraint_level::none)
+  {
+    if (this != std::addressof(rhs)) [[likely]] {
+      *this = proxy_soa{rhs};
+    }
+    return *this;
+  }
+  proxy_soa& operator=(proxy_soa&& rhs) noexcept {
+    if (this != std::addressof(rhs)) [[likely]] {
+      clear();
+      metas_ = std::move(rhs.metas_);
+      slots_ = std::move(rhs.slots_);
+      rhs.metas_.clear();
+      rhs.slots_.clear();
+    }
+    return *this;
+  }
+  ~proxy_soa() { clear(); }
+
+  void push_back(proxy<F> p) {
+    // Resizing (rather than appending to) slots_ keeps both arrays in sync if
+    // growing metas_ throws.
+    slots_.resize(size() + 1u);
+    metas_.push_back(details::proxy_helper::get_meta_ptr(p));
+    std::construct_at(reinterpret_cast<proxy<F>*>(slots_.back().data),
+                      std::move(p));
+  }
+  proxy<F> pop_back() noexcept {
+    assert(!empty());
+    size_type n = size() - 1u;
+    proxy<F> result = std::move(element(n));
+    std::destroy_at(&element(n));
+    metas_.pop_back();
+    slots_.resize(n);
+    return result;
+  }
+  void clear() noexcept {
+    while (!empty()) {
+      pop_back();
+    }
+  }
+  void reserve(size_type n) {
+    metas_.reserve(n);
+    slots_.reserve(n);
+  }
+
+  reference operator[](size_type n) noexcept {
+    assert(n < size());
+    return reference{*this, n};
+  }
+  const_reference operator[](size_type n) const noexcept {
+    assert(n < size());
+    return const_reference{*this, n};
+  }
+  iterator begin() noexcept { return iterator{this, 0u}; }
+  const_iterator begin() const noexcept { return const_iterator{this, 0u}; }
+  iterator end() noexcept { return iterator{this, size()}; }
+  const_iterator end() const noexcept { return const_iterator{this, size()}; }
+  size_type size() const noexcept { return metas_.size(); }
+  bool empty() const noexcept { return metas_.empty(); }
+
+  type_token type_at(size_type n) const noexcept {
+    assert(n < size());
+    return type_token{metas_[n]};
+  }
+  static type_token type_of(const proxy<F>& p) noexcept {
+    return type_token{details::proxy_helper::get_meta_ptr(p)};
+  }
+
+private:
+  proxy<F>& element(size_type n) noexcept {
+    return *std::launder(reinterpret_cast<proxy<F>*>(slots_[n].data));
+  }
+  const proxy<F>& element(size_type n) const noexcept {
+    return *std::launder(reinterpret_cast<const proxy<F>*>(slots_[n].data));
+  }
+
+  std::vector<meta_ptr> metas_;
+  std::vector<slot> slots_;
+};
+#endif // __STDC_HOSTED__
+
 } // namespace pro::inline v4
 
 // =============================================================================
@@ -8,21 +8,32 @@ export namespace pro::inline v4 {
 
 using v4::allocate_proxy;
 using v4::allocate_proxy_shared;
+using v4::allocate_proxy_shared_biased;
+using v4::allocate_proxy_shared_deferred;
+using v4::allocate_proxy_shared_local;
+using v4::atomic_proxy;
 using v4::bad_proxy_cast;
 using v4::basic_facade_builder;
+using v4::compact_arena;
 using v4::constraint_level;
+using v4::destroy_n;
 using v4::conversion_dispatch;
 using v4::explicit_conversion_dispatch;
 using v4::facade;
 using v4::facade_aware_overload_t;
 using v4::facade_builder;
+using v4::grouped_proxy_vector;
 using v4::implicit_conversion_dispatch;
 using v4::inplace_proxiable_target;
 using v4::is_bitwise_trivially_relocatable;
 using v4::is_bitwise_trivially_relocatable_v;
 using v4::make_proxy;
+using v4::make_proxy_in;
 using v4::make_proxy_inplace;
 using v4::make_proxy_shared;
+using v4::make_proxy_shared_biased;
+using v4::make_proxy_shared_deferred;
+using v4::make_proxy_shared_local;
 using v4::make_proxy_view;
 using v4::not_implemented;
 using v4::observer_facade;
@@ -30,14 +41,24 @@ using v4::operator_dispatch;
 using v4::proxiable;
 using v4::proxiable_target;
 using v4::proxy;
+using v4::proxy_arena;
+using v4::proxy_batch;
 using v4::proxy_indirect_accessor;
 using v4::proxy_invoke;
+using v4::proxy_invoke_batch;
 using v4::proxy_reflect;
+using v4::proxy_soa;
+using v4::proxy_vector;
 using v4::proxy_view;
+using v4::rcu_cell;
+using v4::reclaim;
 using v4::substitution_dispatch;
+using v4::uninitialized_copy_n;
+using v4::uninitialized_relocate_n;
 using v4::weak_dispatch;
 using v4::weak_facade;
 using v4::weak_proxy;
+using v4::write_speculation_profile;
 
 namespace skills {
 
@@ -54,7 +75,18 @@ using skills::rtti;
 
 using skills::as_view;
 using skills::as_weak;
+using skills::compact;
+using skills::cow;
+using skills::in_place_assignment;
+using skills::pooled_meta;
+using skills::profile_speculation;
+using skills::register_dispatch;
+using skills::shared_meta;
 using skills::slim;
+using skills::speculate;
+using skills::stateless;
+using skills::tagged;
+using skills::thread_caching;
 
 } // namespace skills
 
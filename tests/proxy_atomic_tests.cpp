@@ -0,0 +1,283 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "utils.h"
+#include <algorithm>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <proxy/proxy.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace proxy_atomic_tests_details {
+
+struct TestFacade
+    : pro::facade_builder                                              //
+      ::add_convention<utils::spec::FreeToString, std::string() const> //
+      ::support_copy<pro::constraint_level::nothrow>                   //
+      ::add_skill<pro::skills::shared_ownership>                       //
+      ::build {};
+
+struct TestTaggedFacade : pro::facade_builder              //
+                          ::add_facade<TestFacade>         //
+                          ::add_skill<pro::skills::tagged> //
+                          ::build {};
+
+struct TestViewFacade
+    : pro::facade_builder                                              //
+      ::add_convention<utils::spec::FreeToString, std::string() const> //
+      ::add_skill<pro::skills::as_view>                                //
+      ::build {};
+
+template <class F>
+concept AtomicProxyApplicable = requires { typename pro::atomic_proxy<F>; };
+
+// Values stored inline or owned exclusively are not identified by an address
+static_assert(AtomicProxyApplicable<TestFacade>);
+static_assert(!AtomicProxyApplicable<TestViewFacade>);
+static_assert(!pro::inplace_proxiable_target<int, TestFacade>);
+static_assert(!pro::proxiable<int*, TestFacade>);
+
+constexpr std::size_t kReclaimThreshold =
+    pro::details::epoch_domain::reclaim_threshold;
+
+std::size_t CountDestructions(const utils::LifetimeTracker& tracker) {
+  return static_cast<std::size_t>(std::ranges::count_if(
+      tracker.GetOperations(), [](const utils::LifetimeOperation& op) {
+        return op.type_ == utils::LifetimeOperationType::kDestruction;
+      }));
+}
+
+std::string ReadString(const pro::rcu_cell<TestViewFacade>& cell) {
+  return cell.read([](pro::proxy_view<TestViewFacade> view) {
+    return view.has_value() ? ToString(*view) : std::string{};
+  });
+}
+
+} // namespace proxy_atomic_tests_details
+
+namespace details = proxy_atomic_tests_details;
+
+TEST(ProxyAtomicTests, TestAtomicProxy_Empty) {
+  pro::atomic_proxy<details::TestFacade> a;
+  ASSERT_FALSE(a.load().has_value());
+  a.store(pro::make_proxy_shared<details::TestFacade>(123));
+  ASSERT_TRUE(a.load().has_value());
+  a.store(nullptr);
+  ASSERT_FALSE(a.load().has_value());
+}
+
+TEST(ProxyAtomicTests, TestAtomicProxy_LoadStore) {
+  pro::atomic_proxy<details::TestFacade> a =
+      pro::make_proxy_shared<details::TestFacade>(1);
+  pro::proxy<details::TestFacade> p1 = a;
+  ASSERT_EQ(ToString(*p1), "1");
+  a = pro::make_proxy_shared<details::TestFacade>(2);
+  ASSERT_EQ(ToString(*a.load()), "2");
+  ASSERT_EQ(ToString(*p1), "1");
+}
+
+TEST(ProxyAtomicTests, TestAtomicProxy_Exchange) {
+  pro::atomic_proxy<details::TestFacade> a;
+  auto p1 = a.exchange(pro::make_proxy_shared<details::TestFacade>(1));
+  ASSERT_FALSE(p1.has_value());
+  auto p2 = a.exchange(pro::make_proxy_shared<details::TestFacade>(2));
+  ASSERT_EQ(ToString(*p2), "1");
+  ASSERT_EQ(ToString(*a.load()), "2");
+}
+
+TEST(ProxyAtomicTests, TestAtomicProxy_CompareExchange) {
+  pro::atomic_proxy<details::TestFacade> a =
+      pro::make_proxy_shared<details::TestFacade>(1);
+  auto expected = a.load();
+  auto stale = expected;
+  ASSERT_TRUE(a.compare_exchange_strong(
+      expected, pro::make_proxy_shared<details::TestFacade>(2)));
+  ASSERT_EQ(ToString(*a.load()), "2");
+
+  // Equal values do not make equivalent proxies unless they share ownership
+  auto other = pro::make_proxy_shared<details::TestFacade>(2);
+  ASSERT_FALSE(a.compare_exchange_strong(
+      other, pro::make_proxy_shared<details::TestFacade>(3)));
+  ASSERT_FALSE(a.compare_exchange_weak(
+      stale, pro::make_proxy_shared<details::TestFacade>(3)));
+  ASSERT_EQ(ToString(*stale), "2");
+  ASSERT_TRUE(a.compare_exchange_weak(
+      stale, pro::make_proxy_shared<details::TestFacade>(3)));
+  ASSERT_EQ(ToString(*a.load()), "3");
+
+  pro::proxy<details::TestFacade> empty;
+  ASSERT_FALSE(a.compare_exchange_strong(empty, nullptr));
+  ASSERT_TRUE(a.compare_exchange_strong(empty, nullptr));
+  ASSERT_FALSE(a.load().has_value());
+  ASSERT_FALSE(a.compare_exchange_strong(
+      stale, pro::make_proxy_shared<details::TestFacade>(4)));
+  ASSERT_FALSE(stale.has_value());
+}
+
+TEST(ProxyAtomicTests, TestAtomicProxy_Tagged) {
+  // The values are aligned to a word, so that their addresses can be tagged
+  pro::atomic_proxy<details::TestTaggedFacade> a =
+      pro::make_proxy_shared<details::TestTaggedFacade>(1LL);
+  auto expected = a.load();
+  auto other = pro::make_proxy_shared<details::TestTaggedFacade>(1LL);
+  ASSERT_FALSE(a.compare_exchange_strong(
+      other, pro::make_proxy_shared<details::TestTaggedFacade>(2LL)));
+  ASSERT_TRUE(a.compare_exchange_strong(
+      expected, pro::make_proxy_shared<details::TestTaggedFacade>(2LL)));
+  ASSERT_EQ(ToString(*a.load()), "2");
+}
+
+TEST(ProxyAtomicTests, TestAtomicProxy_Lifetime) {
+  pro::reclaim();
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    pro::atomic_proxy<details::TestFacade> a;
+    a.store(
+        pro::make_proxy_shared<details::TestFacade,
+                               utils::LifetimeTracker::Session>(&tracker));
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    auto p = a.load();
+    a.store(
+        pro::make_proxy_shared<details::TestFacade,
+                               utils::LifetimeTracker::Session>(&tracker));
+    expected_ops.emplace_back(2,
+                              utils::LifetimeOperationType::kValueConstruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+    p.reset();
+    // The replaced node still holds a reference until it is reclaimed
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+    pro::reclaim();
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(2, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyAtomicTests, TestAtomicProxy_ConcurrentUpdate) {
+  constexpr int kThreads = 4;
+  constexpr int kIncrements = 1000;
+  pro::atomic_proxy<details::TestFacade> a =
+      pro::make_proxy_shared<details::TestFacade>(0);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kThreads; ++i) {
+    threads.emplace_back([&] {
+      for (int j = 0; j < kIncrements; ++j) {
+        auto expected = a.load();
+        while (!a.compare_exchange_weak(
+            expected, pro::make_proxy_shared<details::TestFacade>(
+                          std::stoi(ToString(*expected)) + 1))) {}
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  ASSERT_EQ(ToString(*a.load()), std::to_string(kThreads * kIncrements));
+  pro::reclaim();
+}
+
+TEST(ProxyAtomicTests, TestAtomicProxy_BoundedReclamation) {
+  pro::reclaim();
+  utils::LifetimeTracker tracker;
+  {
+    pro::atomic_proxy<details::TestFacade> a;
+    for (std::size_t i = 0u; i < details::kReclaimThreshold; ++i) {
+      a.store(
+          pro::make_proxy_shared<details::TestFacade,
+                                 utils::LifetimeTracker::Session>(&tracker));
+    }
+    // The writer has destroyed the replaced values without a call to reclaim()
+    ASSERT_EQ(details::CountDestructions(tracker),
+              details::kReclaimThreshold - 1u);
+  }
+  ASSERT_EQ(details::CountDestructions(tracker), details::kReclaimThreshold);
+}
+
+TEST(ProxyAtomicTests, TestRcuCell_ReadStore) {
+  pro::rcu_cell<details::TestViewFacade> cell;
+  ASSERT_EQ(details::ReadString(cell), "");
+  cell.store(pro::make_proxy<details::TestViewFacade>(1));
+  ASSERT_EQ(details::ReadString(cell), "1");
+  cell = pro::make_proxy<details::TestViewFacade>(2);
+  ASSERT_EQ(details::ReadString(cell), "2");
+  cell = nullptr;
+  ASSERT_EQ(details::ReadString(cell), "");
+}
+
+TEST(ProxyAtomicTests, TestRcuCell_Lifetime) {
+  pro::reclaim();
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    pro::rcu_cell<details::TestViewFacade> cell =
+        pro::make_proxy<details::TestViewFacade,
+                        utils::LifetimeTracker::Session>(&tracker);
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    cell.read([&](pro::proxy_view<details::TestViewFacade> view) {
+      cell.store(pro::make_proxy<details::TestViewFacade,
+                                 utils::LifetimeTracker::Session>(&tracker));
+      expected_ops.emplace_back(
+          2, utils::LifetimeOperationType::kValueConstruction);
+      std::thread([] { pro::reclaim(); }).join();
+      // The replaced value outlives the read-side critical section
+      ASSERT_EQ(ToString(*view), "Session 1");
+      ASSERT_EQ(details::ReadString(cell), "Session 2");
+      ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+    });
+    pro::reclaim();
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(2, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyAtomicTests, TestRcuCell_ConcurrentRead) {
+  constexpr int kReaders = 4;
+  constexpr int kUpdates = 1000;
+  pro::rcu_cell<details::TestViewFacade> cell =
+      pro::make_proxy<details::TestViewFacade>(0);
+  std::atomic_bool done = false;
+  std::vector<std::thread> readers;
+  for (int i = 0; i < kReaders; ++i) {
+    readers.emplace_back([&] {
+      int last = 0;
+      while (!done.load()) {
+        int current = std::stoi(details::ReadString(cell));
+        ASSERT_GE(current, last);
+        last = current;
+      }
+    });
+  }
+  for (int i = 1; i <= kUpdates; ++i) {
+    cell.store(pro::make_proxy<details::TestViewFacade>(i));
+  }
+  done = true;
+  for (auto& t : readers) {
+    t.join();
+  }
+  ASSERT_EQ(details::ReadString(cell), std::to_string(kUpdates));
+  pro::reclaim();
+}
+
+TEST(ProxyAtomicTests, TestRcuCell_BoundedReclamation) {
+  pro::reclaim();
+  utils::LifetimeTracker tracker;
+  {
+    pro::rcu_cell<details::TestViewFacade> cell;
+    for (std::size_t i = 0u; i < details::kReclaimThreshold; ++i) {
+      cell.store(pro::make_proxy<details::TestViewFacade,
+                                 utils::LifetimeTracker::Session>(&tracker));
+    }
+    // The writer has destroyed the replaced values without a call to reclaim()
+    ASSERT_EQ(details::CountDestructions(tracker),
+              details::kReclaimThreshold - 1u);
+  }
+  ASSERT_EQ(details::CountDestructions(tracker), details::kReclaimThreshold);
+}
@@ -0,0 +1,419 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "utils.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <proxy/proxy.h>
+#include <string>
+#include <vector>
+
+namespace proxy_container_tests_details {
+
+struct TestFacade
+    : pro::facade_builder                                              //
+      ::add_convention<utils::spec::FreeToString, std::string() const> //
+      ::support_copy<pro::constraint_level::nontrivial>                //
+      ::build {};
+
+struct TestTrivialFacade
+    : pro::facade_builder                                   //
+      ::add_facade<utils::spec::Stringable>                 //
+      ::support_copy<pro::constraint_level::trivial>        //
+      ::support_relocation<pro::constraint_level::trivial>  //
+      ::support_destruction<pro::constraint_level::trivial> //
+      ::build {};
+
+struct TestRttiFacade : pro::facade_builder            //
+                        ::add_facade<TestFacade>       //
+                        ::add_skill<pro::skills::rtti> //
+                        ::build {};
+
+struct TestSoaFacade
+    : pro::facade_builder                                  //
+      ::add_facade<TestFacade>                             //
+      ::support_relocation<pro::constraint_level::trivial> //
+      ::add_skill<pro::skills::rtti>                       //
+      ::add_skill<pro::skills::as_view>                    //
+      ::build {};
+
+struct TestSoaLifetimeFacade
+    : pro::facade_builder                                  //
+      ::add_facade<utils::spec::Stringable>                //
+      ::support_relocation<pro::constraint_level::trivial> //
+      ::build {};
+
+template <class F>
+std::vector<std::string> ToStrings(const pro::grouped_proxy_vector<F>& c) {
+  std::vector<std::string> result;
+  for (auto& p : c) {
+    result.push_back(ToString(*p));
+  }
+  return result;
+}
+
+template <class F>
+std::vector<std::string> ToStrings(const pro::proxy_soa<F>& c) {
+  std::vector<std::string> result;
+  for (auto&& p : c) {
+    result.push_back(ToString(**p));
+  }
+  return result;
+}
+
+template <class F>
+std::vector<std::string> ToStrings(const pro::proxy_vector<F>& c) {
+  std::vector<std::string> result;
+  for (auto& p : c) {
+    result.push_back(p.has_value() ? ToString(*p) : std::string{});
+  }
+  return result;
+}
+
+} // namespace proxy_container_tests_details
+
+namespace details = proxy_container_tests_details;
+
+TEST(ProxyContainerTests, TestGroupedProxyVector_Empty) {
+  pro::grouped_proxy_vector<details::TestFacade> c;
+  ASSERT_TRUE(c.empty());
+  ASSERT_EQ(c.size(), 0u);
+  ASSERT_EQ(c.group_count(), 0u);
+  ASSERT_EQ(c.begin(), c.end());
+}
+
+TEST(ProxyContainerTests, TestGroupedProxyVector_Grouping) {
+  pro::grouped_proxy_vector<details::TestFacade> c;
+  for (int i = 0; i < 3; ++i) {
+    c.insert(pro::make_proxy<details::TestFacade>(i));
+    c.insert(pro::make_proxy<details::TestFacade>(i + 10ll));
+    c.insert(pro::make_proxy<details::TestFacade>(i + 0.5));
+  }
+  ASSERT_EQ(c.size(), 9u);
+  ASSERT_EQ(c.group_count(), 3u);
+  for (std::size_t i = 0; i < c.group_count(); ++i) {
+    ASSERT_EQ(c.group(i).size(), 3u);
+  }
+  std::vector<std::string> expected{"0",        "1",        "2",
+                                    "10",       "11",       "12",
+                                    "0.500000", "1.500000", "2.500000"};
+  ASSERT_EQ(details::ToStrings(c), expected);
+}
+
+TEST(ProxyContainerTests, TestGroupedProxyVector_GroupsByPointerType) {
+  int a = 1, b = 2;
+  pro::grouped_proxy_vector<details::TestRttiFacade> c;
+  c.insert(&a);
+  c.insert(pro::make_proxy<details::TestRttiFacade>(3));
+  c.insert(&b);
+  ASSERT_EQ(c.group_count(), 2u);
+  auto g0 = c.group(0);
+  ASSERT_EQ(g0.size(), 2u);
+  ASSERT_EQ(proxy_cast<int&>(*g0[0]), 1);
+  ASSERT_EQ(proxy_cast<int&>(*g0[1]), 2);
+  ASSERT_EQ(c.group(1).size(), 1u);
+  ASSERT_EQ(proxy_cast<int>(*c.group(1)[0]), 3);
+}
+
+TEST(ProxyContainerTests, TestGroupedProxyVector_CopyAndClear) {
+  pro::grouped_proxy_vector<details::TestFacade> c;
+  c.insert(pro::make_proxy<details::TestFacade>(1));
+  c.insert(pro::make_proxy<details::TestFacade>(2ll));
+  pro::grouped_proxy_vector<details::TestFacade> c2 = c;
+  c.clear();
+  ASSERT_TRUE(c.empty());
+  ASSERT_EQ(c.group_count(), 0u);
+  ASSERT_EQ(details::ToStrings(c2), (std::vector<std::string>{"1", "2"}));
+  c.insert(pro::make_proxy<details::TestFacade>(3));
+  ASSERT_EQ(details::ToStrings(c), (std::vector<std::string>{"3"}));
+}
+
+TEST(ProxyContainerTests, TestGroupedProxyVector_Lifetime) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    pro::grouped_proxy_vector<utils::spec::Stringable> c;
+    c.insert(pro::make_proxy<utils::spec::Stringable,
+                             utils::LifetimeTracker::Session>(&tracker));
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    ASSERT_EQ(ToString(*c.group(0)[0]), "Session 1");
+    ASSERT_EQ(tracker.GetOperations(), expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_EQ(tracker.GetOperations(), expected_ops);
+}
+
+TEST(ProxyContainerTests, TestProxySoa_Empty) {
+  pro::proxy_soa<details::TestSoaFacade> c;
+  ASSERT_TRUE(c.empty());
+  ASSERT_EQ(c.size(), 0u);
+  ASSERT_EQ(c.begin(), c.end());
+}
+
+TEST(ProxyContainerTests, TestProxySoa_Access) {
+  pro::proxy_soa<details::TestSoaFacade> c;
+  c.push_back(pro::make_proxy<details::TestSoaFacade>(1));
+  c.push_back(pro::make_proxy<details::TestSoaFacade>(2ll));
+  c.push_back(nullptr);
+  ASSERT_EQ(c.size(), 3u);
+  ASSERT_EQ(ToString(**c[0]), "1");
+  ASSERT_FALSE((*c[2]).has_value());
+  *c[2] = pro::make_proxy<details::TestSoaFacade>(2.5);
+  proxy_cast<long long&>(**c[1]) += 10;
+  ASSERT_EQ(details::ToStrings(c),
+            (std::vector<std::string>{"1", "12", "2.500000"}));
+  pro::proxy<details::TestSoaFacade> p = c.pop_back();
+  ASSERT_EQ(c.size(), 2u);
+  ASSERT_EQ(proxy_cast<double>(*p), 2.5);
+}
+
+TEST(ProxyContainerTests, TestProxySoa_AliasedReferences) {
+  pro::proxy_soa<details::TestSoaFacade> c;
+  c.push_back(pro::make_proxy<details::TestSoaFacade>(1));
+  c.push_back(pro::make_proxy<details::TestSoaFacade>(2));
+  pro::proxy_view<details::TestSoaFacade> view;
+  {
+    auto a = c[0];
+    auto b = c[0];
+    *a = pro::make_proxy<details::TestSoaFacade>(2.5);
+    ASSERT_EQ(ToString(**b), "2.500000");
+    view = *b;
+  }
+  ASSERT_TRUE(c.type_at(0) ==
+              c.type_of(pro::make_proxy<details::TestSoaFacade>(0.5)));
+  // The view observes the element in the container, not a copy
+  proxy_cast<double&>(**c[0]) = 3.5;
+  ASSERT_EQ(ToString(*view), "3.500000");
+  ASSERT_EQ(details::ToStrings(c),
+            (std::vector<std::string>{"3.500000", "2"}));
+}
+
+TEST(ProxyContainerTests, TestProxySoa_TypeTokens) {
+  pro::proxy_soa<details::TestSoaFacade> c;
+  for (int i = 0; i < 3; ++i) {
+    c.push_back(pro::make_proxy<details::TestSoaFacade>(i));
+    c.push_back(pro::make_proxy<details::TestSoaFacade>(i + 0.5));
+  }
+  auto int_type = c.type_of(pro::make_proxy<details::TestSoaFacade>(0));
+  std::size_t count = 0u;
+  for (std::size_t i = 0; i < c.size(); ++i) {
+    if (c.type_at(i) == int_type) {
+      ++count;
+    }
+  }
+  ASSERT_EQ(count, 3u);
+  ASSERT_TRUE(c.type_at(1) == c.type_at(3));
+  ASSERT_FALSE(c.type_at(0) == c.type_at(1));
+}
+
+TEST(ProxyContainerTests, TestProxySoa_CopyAndMove) {
+  pro::proxy_soa<details::TestSoaFacade> c;
+  c.push_back(pro::make_proxy<details::TestSoaFacade>(1));
+  c.push_back(pro::make_proxy<details::TestSoaFacade>(2ll));
+  pro::proxy_soa<details::TestSoaFacade> c2 = c;
+  proxy_cast<long long&>(**c2[1]) = 3;
+  ASSERT_EQ(details::ToStrings(c), (std::vector<std::string>{"1", "2"}));
+  ASSERT_EQ(details::ToStrings(c2), (std::vector<std::string>{"1", "3"}));
+  c = std::move(c2);
+  ASSERT_TRUE(c2.empty());
+  ASSERT_EQ(details::ToStrings(c), (std::vector<std::string>{"1", "3"}));
+  c.clear();
+  ASSERT_TRUE(c.empty());
+}
+
+TEST(ProxyContainerTests, TestProxySoa_Lifetime) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    pro::proxy_soa<details::TestSoaLifetimeFacade> c;
+    c.push_back(pro::make_proxy<details::TestSoaLifetimeFacade,
+                                utils::LifetimeTracker::Session>(&tracker));
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    c.push_back(pro::make_proxy<details::TestSoaLifetimeFacade,
+                                utils::LifetimeTracker::Session>(&tracker));
+    expected_ops.emplace_back(2,
+                              utils::LifetimeOperationType::kValueConstruction);
+    ASSERT_EQ(ToString(**c[0]), "Session 1");
+    ASSERT_EQ(ToString(**c[1]), "Session 2");
+    ASSERT_EQ(tracker.GetOperations(), expected_ops);
+  }
+  expected_ops.emplace_back(2, utils::LifetimeOperationType::kDestruction);
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_EQ(tracker.GetOperations(), expected_ops);
+}
+
+TEST(ProxyContainerTests, TestProxyVector_Empty) {
+  pro::proxy_vector<details::TestFacade> c;
+  ASSERT_TRUE(c.empty());
+  ASSERT_EQ(c.size(), 0u);
+  ASSERT_EQ(c.capacity(), 0u);
+  ASSERT_EQ(c.begin(), c.end());
+}
+
+TEST(ProxyContainerTests, TestProxyVector_Access) {
+  pro::proxy_vector<details::TestFacade> c;
+  std::vector<std::string> expected;
+  for (int i = 0; i < 100; ++i) {
+    if (i % 10 == 0) {
+      c.push_back(nullptr);
+      expected.push_back("");
+    } else if (i % 2 == 0) {
+      c.push_back(pro::make_proxy<details::TestFacade>(i));
+      expected.push_back(std::to_string(i));
+    } else {
+      c.push_back(pro::make_proxy<details::TestFacade>(i * 0.5));
+      expected.push_back(std::to_string(i * 0.5));
+    }
+  }
+  ASSERT_EQ(c.size(), 100u);
+  ASSERT_GE(c.capacity(), 100u);
+  ASSERT_EQ(details::ToStrings(c), expected);
+  c.pop_back();
+  expected.pop_back();
+  ASSERT_EQ(details::ToStrings(c), expected);
+  c.reserve(1000u);
+  ASSERT_EQ(c.capacity(), 1000u);
+  ASSERT_EQ(details::ToStrings(c), expected);
+}
+
+TEST(ProxyContainerTests, TestProxyVector_CopyAndMove) {
+  pro::proxy_vector<details::TestFacade> c;
+  c.push_back(pro::make_proxy<details::TestFacade>(1));
+  c.push_back(pro::make_proxy<details::TestFacade>(2));
+  pro::proxy_vector<details::TestFacade> c2 = c;
+  c[0] = pro::make_proxy<details::TestFacade>(3);
+  ASSERT_EQ(details::ToStrings(c), (std::vector<std::string>{"3", "2"}));
+  ASSERT_EQ(details::ToStrings(c2), (std::vector<std::string>{"1", "2"}));
+  c = std::move(c2);
+  ASSERT_TRUE(c2.empty());
+  ASSERT_EQ(details::ToStrings(c), (std::vector<std::string>{"1", "2"}));
+  c2 = c;
+  c.clear();
+  ASSERT_TRUE(c.empty());
+  ASSERT_EQ(details::ToStrings(c2), (std::vector<std::string>{"1", "2"}));
+}
+
+TEST(ProxyContainerTests, TestProxyVector_Lifetime) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    pro::proxy_vector<utils::spec::Stringable> c;
+    for (int i = 1; i <= 5; ++i) {
+      c.push_back(pro::make_proxy<utils::spec::Stringable,
+                                  utils::LifetimeTracker::Session>(&tracker));
+      expected_ops.emplace_back(
+          i, utils::LifetimeOperationType::kValueConstruction);
+    }
+    // Growing the storage does not copy or move the values
+    ASSERT_EQ(ToString(*c[4]), "Session 5");
+    ASSERT_EQ(tracker.GetOperations(), expected_ops);
+  }
+  for (int i = 1; i <= 5; ++i) {
+    expected_ops.emplace_back(i, utils::LifetimeOperationType::kDestruction);
+  }
+  ASSERT_EQ(tracker.GetOperations(), expected_ops);
+}
+
+TEST(ProxyContainerTests, TestProxyVector_CopyFailure) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    pro::proxy_vector<details::TestFacade> c;
+    for (int i = 1; i <= 3; ++i) {
+      c.push_back(pro::make_proxy<details::TestFacade,
+                                  utils::LifetimeTracker::Session>(&tracker));
+      expected_ops.emplace_back(
+          i, utils::LifetimeOperationType::kValueConstruction);
+    }
+    tracker.ThrowOnNextConstruction();
+    // The storage of the copy is released, which leak checkers verify
+    ASSERT_THROW(pro::proxy_vector<details::TestFacade>{c},
+                 utils::ConstructionFailure);
+    ASSERT_EQ(tracker.GetOperations(), expected_ops);
+    ASSERT_EQ(c.size(), 3u);
+  }
+  for (int i = 1; i <= 3; ++i) {
+    expected_ops.emplace_back(i, utils::LifetimeOperationType::kDestruction);
+  }
+  ASSERT_EQ(tracker.GetOperations(), expected_ops);
+}
+
+TEST(ProxyContainerTests, TestBulkLifetime) {
+  std::allocator<pro::proxy<details::TestFacade>> alloc;
+  constexpr std::size_t kCount = 7u;
+  auto* a = alloc.allocate(kCount);
+  auto* b = alloc.allocate(kCount);
+  auto* c = alloc.allocate(kCount);
+  for (std::size_t i = 0; i < kCount; ++i) {
+    if (i == 3u) {
+      std::construct_at(a + i);
+    } else if (i < 3u) {
+      std::construct_at(a + i, pro::make_proxy<details::TestFacade>(i));
+    } else {
+      std::construct_at(a + i, pro::make_proxy<details::TestFacade>(i * 0.5));
+    }
+  }
+  ASSERT_EQ(pro::uninitialized_copy_n(a, kCount, b), b + kCount);
+  ASSERT_EQ(pro::uninitialized_relocate_n(b, kCount, c), c + kCount);
+  for (std::size_t i = 0; i < kCount; ++i) {
+    if (i == 3u) {
+      ASSERT_FALSE(c[i].has_value());
+    } else {
+      ASSERT_EQ(ToString(*c[i]), ToString(*a[i]));
+    }
+  }
+  ASSERT_EQ(pro::destroy_n(a, kCount), a + kCount);
+  pro::destroy_n(c, kCount);
+  alloc.deallocate(a, kCount);
+  alloc.deallocate(b, kCount);
+  alloc.deallocate(c, kCount);
+}
+
+TEST(ProxyContainerTests, TestBulkLifetime_Trivial) {
+  // An empty range may be null, like the storage of an empty proxy_vector
+  pro::proxy<details::TestTrivialFacade>* null = nullptr;
+  ASSERT_EQ(pro::uninitialized_copy_n(null, 0u, null), null);
+  ASSERT_EQ(pro::uninitialized_relocate_n(null, 0u, null), null);
+  int values[] = {1, 2, 3};
+  pro::proxy_vector<details::TestTrivialFacade> v;
+  for (int& value : values) {
+    v.push_back(&value);
+  }
+  pro::proxy_vector<details::TestTrivialFacade> copy = v;
+  ASSERT_EQ(copy.size(), 3u);
+  ASSERT_EQ(ToString(*copy[2]), "3");
+}
+
+TEST(ProxyContainerTests, TestBulkLifetime_CopyFailure) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    std::vector<pro::proxy<details::TestFacade>> src;
+    for (int i = 1; i <= 3; ++i) {
+      src.push_back(
+          pro::make_proxy<details::TestFacade,
+                          utils::LifetimeTracker::Session>(&tracker));
+      expected_ops.emplace_back(
+          i, utils::LifetimeOperationType::kValueConstruction);
+    }
+    std::allocator<pro::proxy<details::TestFacade>> alloc;
+    auto* dst = alloc.allocate(3u);
+    pro::uninitialized_copy_n(src.data(), 1u, dst);
+    expected_ops.emplace_back(4,
+                              utils::LifetimeOperationType::kCopyConstruction);
+    pro::destroy_n(dst, 1u);
+    expected_ops.emplace_back(4, utils::LifetimeOperationType::kDestruction);
+    ASSERT_EQ(tracker.GetOperations(), expected_ops);
+    tracker.ThrowOnNextConstruction();
+    ASSERT_THROW(pro::uninitialized_copy_n(src.data(), 3u, dst),
+                 utils::ConstructionFailure);
+    ASSERT_EQ(tracker.GetOperations(), expected_ops);
+    alloc.deallocate(dst, 3u);
+  }
+  for (int i = 1; i <= 3; ++i) {
+    expected_ops.emplace_back(i, utils::LifetimeOperationType::kDestruction);
+  }
+  ASSERT_EQ(tracker.GetOperations(), expected_ops);
+}
@@ -5,6 +5,7 @@
 #include <gtest/gtest.h>
 #include <memory_resource>
 #include <proxy/proxy.h>
+#include <thread>
 
 namespace proxy_creation_tests_details {
 
@@ -14,7 +15,16 @@ enum LifetimeModelType {
   kAllocated,
   kCompact,
   kSharedCompact,
-  kStrongCompact
+  kStrongCompact,
+  kLocalSharedCompact,
+  kLocalStrongCompact,
+  kBiasedSharedCompact,
+  kBiasedStrongCompact,
+  kDeferredSharedCompact,
+  kDeferredStrongCompact,
+  kCow,
+  kArena,
+  kProxyArena
 };
 
 struct LifetimeModelReflector {
@@ -46,6 +56,70 @@ struct LifetimeModelReflector {
     static_assert(sizeof(pro::details::strong_compact_ptr<T, Alloc>) ==
                   sizeof(void*));
   }
+  template <class T, class Alloc>
+  constexpr explicit LifetimeModelReflector(
+      std::in_place_type_t<pro::details::shared_compact_ptr<
+          T, Alloc, pro::details::local_ref_count>>)
+      : Type(LifetimeModelType::kLocalSharedCompact) {
+    static_assert(sizeof(pro::details::shared_compact_ptr<
+                         T, Alloc, pro::details::local_ref_count>) ==
+                  sizeof(void*));
+  }
+  template <class T, class Alloc>
+  constexpr explicit LifetimeModelReflector(
+      std::in_place_type_t<pro::details::strong_compact_ptr<
+          T, Alloc, pro::details::local_ref_count>>)
+      : Type(LifetimeModelType::kLocalStrongCompact) {
+    static_assert(sizeof(pro::details::strong_compact_ptr<
+                         T, Alloc, pro::details::local_ref_count>) ==
+                  sizeof(void*));
+  }
+  template <class T, class Alloc>
+  constexpr explicit LifetimeModelReflector(
+      std::in_place_type_t<pro::details::shared_compact_ptr<
+          T, Alloc, pro::details::biased_ref_count>>)
+      : Type(LifetimeModelType::kBiasedSharedCompact) {}
+  template <class T, class Alloc>
+  constexpr explicit LifetimeModelReflector(
+      std::in_place_type_t<pro::details::strong_compact_ptr<
+          T, Alloc, pro::details::biased_ref_count>>)
+      : Type(LifetimeModelType::kBiasedStrongCompact) {}
+  template <class T, class Alloc>
+  constexpr explicit LifetimeModelReflector(
+      std::in_place_type_t<pro::details::shared_compact_ptr<
+          T, Alloc, pro::details::deferred_ref_count>>)
+      : Type(LifetimeModelType::kDeferredSharedCompact) {
+    static_assert(sizeof(pro::details::shared_compact_ptr<
+                         T, Alloc, pro::details::deferred_ref_count>) ==
+                  sizeof(void*));
+  }
+  template <class T, class Alloc>
+  constexpr explicit LifetimeModelReflector(
+      std::in_place_type_t<pro::details::strong_compact_ptr<
+          T, Alloc, pro::details::deferred_ref_count>>)
+      : Type(LifetimeModelType::kDeferredStrongCompact) {
+    static_assert(sizeof(pro::details::strong_compact_ptr<
+                         T, Alloc, pro::details::deferred_ref_count>) ==
+                  sizeof(void*));
+  }
+  template <class T, class Alloc>
+  constexpr explicit LifetimeModelReflector(
+      std::in_place_type_t<pro::details::cow_ptr<T, Alloc>>)
+      : Type(LifetimeModelType::kCow) {
+    static_assert(sizeof(pro::details::cow_ptr<T, Alloc>) == sizeof(void*));
+  }
+  template <class T>
+  constexpr explicit LifetimeModelReflector(
+      std::in_place_type_t<pro::details::arena_ptr<T>>)
+      : Type(LifetimeModelType::kArena) {
+    static_assert(sizeof(pro::details::arena_ptr<T>) == sizeof(std::uint32_t));
+  }
+  template <class T>
+  constexpr explicit LifetimeModelReflector(
+      std::in_place_type_t<pro::details::proxy_arena_ptr<T>>)
+      : Type(LifetimeModelType::kProxyArena) {
+    static_assert(sizeof(pro::details::proxy_arena_ptr<T>) == sizeof(void*));
+  }
   template <class T>
   constexpr explicit LifetimeModelReflector(std::in_place_type_t<T>)
       : Type(LifetimeModelType::kNone) {}
@@ -75,6 +149,73 @@ struct TestSmallStringable : pro::facade_builder               //
                              ::restrict_layout<sizeof(void*)>  //
                              ::build {};
 
+struct TestTaggedStringable : pro::facade_builder               //
+                              ::add_facade<TestLargeStringable> //
+                              ::add_skill<pro::skills::tagged>  //
+                              ::build {};
+static_assert(sizeof(pro::proxy<TestTaggedStringable>) == sizeof(void*));
+static_assert(
+    !pro::inplace_proxiable_target<utils::LifetimeTracker::Session,
+                                   TestTaggedStringable>);
+
+struct TestTaggedEmpty : pro::facade_builder              //
+                         ::add_skill<pro::skills::tagged> //
+                         ::build {};
+
+template <int I>
+struct alignas(void*) TestTaggedSlot {};
+
+struct TestSmallBufferStringable : pro::facade_builder               //
+                                   ::add_facade<TestSmallStringable> //
+                                   ::small_buffer<4 * sizeof(void*)> //
+                                   ::build {};
+static_assert(TestSmallBufferStringable::max_size == 4 * sizeof(void*));
+static_assert(TestSmallBufferStringable::max_align ==
+              alignof(std::max_align_t));
+static_assert(!pro::inplace_proxiable_target<utils::LifetimeTracker::Session,
+                                             TestSmallStringable>);
+static_assert(pro::inplace_proxiable_target<utils::LifetimeTracker::Session,
+                                            TestSmallBufferStringable>);
+
+struct TestThreadCachingStringable
+    : pro::facade_builder                      //
+      ::add_facade<TestSmallStringable>        //
+      ::add_skill<pro::skills::thread_caching> //
+      ::build {};
+
+struct TestCowStringable
+    : pro::facade_builder                                              //
+      ::add_convention<utils::spec::FreeToString, std::string() const, //
+                       std::string()>                                  //
+      ::support_copy<pro::constraint_level::nothrow>                   //
+      ::restrict_layout<sizeof(void*)>                                 //
+      ::add_direct_reflection<LifetimeModelReflector>                  //
+      ::add_skill<pro::skills::cow>                                    //
+      ::build {};
+
+struct TestCompactStringable : pro::facade_builder               //
+                               ::add_facade<TestLargeStringable> //
+                               ::add_skill<pro::skills::compact> //
+                               ::build {};
+static_assert(sizeof(pro::proxy<TestCompactStringable>) ==
+              2 * sizeof(std::uint32_t));
+
+struct TestTrivialStringable
+    : pro::facade_builder                                        //
+      ::add_convention<utils::spec::FreeToString, std::string()> //
+      ::support_destruction<pro::constraint_level::trivial>      //
+      ::build {};
+static_assert(
+    std::is_trivially_destructible_v<pro::proxy<TestTrivialStringable>>);
+
+// Larger than a chunk of proxy_arena
+struct LargeTrivialValue {
+  int Values[pro::proxy_arena::chunk_size / sizeof(int)];
+};
+std::string to_string(const LargeTrivialValue& self) {
+  return std::to_string(self.Values[0]);
+}
+
 PRO_DEF_MEM_DISPATCH(MemFn0, MemFn0);
 struct TestMemFn0 : pro::facade_builder                          //
                     ::add_convention<MemFn0, void(int) noexcept> //
@@ -686,6 +827,257 @@ TEST(ProxyCreationTests, TestMakeProxy_WithoutSBO_Lifetime_Move) {
   ASSERT_TRUE(tracker.GetOperations() == expected_ops);
 }
 
+TEST(ProxyCreationTests, TestMakeProxy_Tagged_FromValue) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  utils::LifetimeTracker::Session session{&tracker};
+  expected_ops.emplace_back(1,
+                            utils::LifetimeOperationType::kValueConstruction);
+  {
+    auto p = pro::make_proxy<details::TestTaggedStringable>(session);
+    ASSERT_TRUE(p.has_value());
+    ASSERT_EQ(ToString(*p), "Session 2");
+    ASSERT_EQ(p.GetLifetimeType(), details::LifetimeModelType::kAllocated);
+    expected_ops.emplace_back(2,
+                              utils::LifetimeOperationType::kCopyConstruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(2, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestMakeProxy_Tagged_Lifetime_Copy) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p1 = pro::make_proxy<details::TestTaggedStringable,
+                              utils::LifetimeTracker::Session>(&tracker);
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    auto p2 = p1;
+    ASSERT_TRUE(p1.has_value());
+    ASSERT_EQ(ToString(*p1), "Session 1");
+    ASSERT_TRUE(p2.has_value());
+    ASSERT_EQ(ToString(*p2), "Session 2");
+    ASSERT_EQ(p2.GetLifetimeType(), details::LifetimeModelType::kAllocated);
+    expected_ops.emplace_back(2,
+                              utils::LifetimeOperationType::kCopyConstruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(2, utils::LifetimeOperationType::kDestruction);
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestMakeProxy_Tagged_Lifetime_Move) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p1 = pro::make_proxy<details::TestTaggedStringable,
+                              utils::LifetimeTracker::Session>(&tracker);
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    auto p2 = std::move(p1);
+    ASSERT_FALSE(p1.has_value());
+    ASSERT_TRUE(p2.has_value());
+    ASSERT_EQ(ToString(*p2), "Session 1");
+    ASSERT_EQ(p2.GetLifetimeType(), details::LifetimeModelType::kAllocated);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestMakeProxy_Tagged_TooManyTypes) {
+  // Each contained type takes one of the non-zero values of the tag
+  []<int... Is>(std::integer_sequence<int, Is...>) {
+    (pro::make_proxy<details::TestTaggedEmpty, details::TestTaggedSlot<Is>>(),
+     ...);
+  }(std::make_integer_sequence<int, static_cast<int>(alignof(void*)) - 1>{});
+  utils::LifetimeTracker tracker;
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_THROW((pro::make_proxy<details::TestTaggedEmpty,
+                                  utils::LifetimeTracker::Session>(&tracker)),
+                 std::bad_alloc);
+  }
+  ASSERT_TRUE(tracker.GetOperations().empty());
+  auto p =
+      pro::make_proxy<details::TestTaggedEmpty, details::TestTaggedSlot<0>>();
+  ASSERT_TRUE(p.has_value());
+}
+
+TEST(ProxyCreationTests, TestMakeProxyShared_Tagged_Lifetime_Copy) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p1 = pro::make_proxy_shared<details::TestTaggedStringable,
+                                     utils::LifetimeTracker::Session>(&tracker);
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    auto p2 = p1;
+    p1.reset();
+    ASSERT_FALSE(p1.has_value());
+    ASSERT_EQ(ToString(*p2), "Session 1");
+    ASSERT_EQ(p2.GetLifetimeType(),
+              details::LifetimeModelType::kSharedCompact);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestMakeProxy_SmallBuffer) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p1 = pro::make_proxy<details::TestSmallBufferStringable,
+                              utils::LifetimeTracker::Session>(&tracker);
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    ASSERT_EQ(p1.GetLifetimeType(), details::LifetimeModelType::kInplace);
+    auto p2 = pro::make_proxy<details::TestSmallBufferStringable>(
+        details::LargeTrivialValue{{123}});
+    ASSERT_EQ(p2.GetLifetimeType(), details::LifetimeModelType::kAllocated);
+    ASSERT_EQ(ToString(*p2), "123");
+    ASSERT_EQ(ToString(*p1), "Session 1");
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestMakeProxy_ThreadCaching_Lifetime_Copy) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p1 = pro::make_proxy<details::TestThreadCachingStringable,
+                              utils::LifetimeTracker::Session>(&tracker);
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    auto p2 = p1;
+    ASSERT_EQ(ToString(*p1), "Session 1");
+    ASSERT_EQ(ToString(*p2), "Session 2");
+    ASSERT_EQ(p2.GetLifetimeType(), details::LifetimeModelType::kAllocated);
+    expected_ops.emplace_back(2,
+                              utils::LifetimeOperationType::kCopyConstruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(2, utils::LifetimeOperationType::kDestruction);
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestMakeProxyShared_ThreadCaching_Lifetime_Copy) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p1 = pro::make_proxy_shared<details::TestThreadCachingStringable,
+                                     utils::LifetimeTracker::Session>(&tracker);
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    auto p2 = p1;
+    p1.reset();
+    ASSERT_EQ(ToString(*p2), "Session 1");
+    ASSERT_EQ(p2.GetLifetimeType(),
+              details::LifetimeModelType::kSharedCompact);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestMakeProxy_Cow_Lifetime_Copy) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p1 = pro::make_proxy<details::TestCowStringable,
+                              utils::LifetimeTracker::Session>(&tracker);
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    ASSERT_EQ(p1.GetLifetimeType(), details::LifetimeModelType::kCow);
+    auto p2 = p1;
+    auto p3 = p1;
+    ASSERT_EQ(ToString(std::as_const(*p2)), "Session 1");
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+
+    // Non-const access clones the shared value
+    ASSERT_EQ(ToString(*p2), "Session 2");
+    expected_ops.emplace_back(2,
+                              utils::LifetimeOperationType::kCopyConstruction);
+    ASSERT_EQ(ToString(*p2), "Session 2");
+    ASSERT_EQ(ToString(std::as_const(*p1)), "Session 1");
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+
+    p3.reset();
+    ASSERT_EQ(ToString(*p1), "Session 1");
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(2, utils::LifetimeOperationType::kDestruction);
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestAllocateProxy_Cow_Lifetime_Copy) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  std::pmr::unsynchronized_pool_resource pool;
+  {
+    auto p1 = pro::allocate_proxy<details::TestCowStringable,
+                                  utils::LifetimeTracker::Session>(
+        std::pmr::polymorphic_allocator<>{&pool}, &tracker);
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    ASSERT_EQ(p1.GetLifetimeType(), details::LifetimeModelType::kCow);
+    auto p2 = p1;
+    p1.reset();
+    // The value is no longer shared
+    ASSERT_EQ(ToString(*p2), "Session 1");
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestMakeProxy_Cow_ConstructionFailure) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p1 = pro::make_proxy<details::TestCowStringable,
+                              utils::LifetimeTracker::Session>(&tracker);
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    auto p2 = p1;
+    tracker.ThrowOnNextConstruction();
+    bool exception_thrown = false;
+    try {
+      ToString(*p2);
+    } catch (const utils::ConstructionFailure& e) {
+      exception_thrown = true;
+      ASSERT_EQ(e.type_, utils::LifetimeOperationType::kCopyConstruction);
+    }
+    ASSERT_TRUE(exception_thrown);
+    // Both proxies still share the original value
+    ASSERT_EQ(ToString(std::as_const(*p1)), "Session 1");
+    ASSERT_EQ(ToString(std::as_const(*p2)), "Session 1");
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestThreadCachingAllocator_Recycle) {
+  pro::details::thread_caching_allocator<utils::LifetimeTracker::Session> alloc;
+  auto* ptr = alloc.allocate(1);
+  alloc.deallocate(ptr, 1);
+  ASSERT_EQ(alloc.allocate(1), ptr);
+  std::thread([&] {
+    // Blocks freed on another thread are cached by that thread
+    alloc.deallocate(ptr, 1);
+    ASSERT_EQ(alloc.allocate(1), ptr);
+    alloc.deallocate(ptr, 1);
+  }).join();
+}
+
 TEST(ProxyCreationTests, TestMakeProxy_SfinaeUnsafe) {
   pro::proxy<details::SfinaeUnsafeFacade> p =
       pro::make_proxy<details::SfinaeUnsafeFacade, int>();
@@ -1024,17 +1416,19 @@ TEST(ProxyCreationTests, TestMakeProxyShared_SharedCompact_Lifetime_Move) {
   ASSERT_TRUE(tracker.GetOperations() == expected_ops);
 }
 
-TEST(ProxyCreationTests, TestMakeProxyShared_StrongCompact_FromValue) {
+TEST(ProxyCreationTests, TestMakeProxyIn_FromValue) {
   utils::LifetimeTracker tracker;
   std::vector<utils::LifetimeOperation> expected_ops;
   utils::LifetimeTracker::Session session{&tracker};
   expected_ops.emplace_back(1,
                             utils::LifetimeOperationType::kValueConstruction);
+  pro::compact_arena arena{1024u};
   {
-    auto p = pro::make_proxy_shared<details::TestWeakSharedStringable>(session);
+    auto p = pro::make_proxy_in<details::TestCompactStringable>(arena, session);
     ASSERT_TRUE(p.has_value());
     ASSERT_EQ(ToString(*p), "Session 2");
-    ASSERT_EQ(p.GetLifetimeType(), details::LifetimeModelType::kStrongCompact);
+    ASSERT_EQ(p.GetLifetimeType(), details::LifetimeModelType::kArena);
+    ASSERT_EQ(arena.size(), sizeof(utils::LifetimeTracker::Session));
     expected_ops.emplace_back(2,
                               utils::LifetimeOperationType::kCopyConstruction);
     ASSERT_TRUE(tracker.GetOperations() == expected_ops);
@@ -1043,15 +1437,17 @@ TEST(ProxyCreationTests, TestMakeProxyShared_StrongCompact_FromValue) {
   ASSERT_TRUE(tracker.GetOperations() == expected_ops);
 }
 
-TEST(ProxyCreationTests, TestMakeProxyShared_StrongCompact_InPlace) {
+TEST(ProxyCreationTests, TestMakeProxyIn_InPlace) {
   utils::LifetimeTracker tracker;
   std::vector<utils::LifetimeOperation> expected_ops;
+  pro::compact_arena arena{1024u};
   {
-    auto p = pro::make_proxy_shared<details::TestWeakSharedStringable,
-                                    utils::LifetimeTracker::Session>(&tracker);
+    auto p = pro::make_proxy_in<details::TestCompactStringable,
+                                utils::LifetimeTracker::Session>(arena,
+                                                                 &tracker);
     ASSERT_TRUE(p.has_value());
     ASSERT_EQ(ToString(*p), "Session 1");
-    ASSERT_EQ(p.GetLifetimeType(), details::LifetimeModelType::kStrongCompact);
+    ASSERT_EQ(p.GetLifetimeType(), details::LifetimeModelType::kArena);
     expected_ops.emplace_back(1,
                               utils::LifetimeOperationType::kValueConstruction);
     ASSERT_TRUE(tracker.GetOperations() == expected_ops);
@@ -1060,17 +1456,17 @@ TEST(ProxyCreationTests, TestMakeProxyShared_StrongCompact_InPlace) {
   ASSERT_TRUE(tracker.GetOperations() == expected_ops);
 }
 
-TEST(ProxyCreationTests,
-     TestMakeProxyShared_StrongCompact_InPlaceInitializerList) {
+TEST(ProxyCreationTests, TestMakeProxyIn_InPlaceInitializerList) {
   utils::LifetimeTracker tracker;
   std::vector<utils::LifetimeOperation> expected_ops;
+  pro::compact_arena arena{1024u};
   {
-    auto p = pro::make_proxy_shared<details::TestWeakSharedStringable,
-                                    utils::LifetimeTracker::Session>({1, 2, 3},
-                                                                     &tracker);
+    auto p = pro::make_proxy_in<details::TestCompactStringable,
+                                utils::LifetimeTracker::Session>(
+        arena, {1, 2, 3}, &tracker);
     ASSERT_TRUE(p.has_value());
     ASSERT_EQ(ToString(*p), "Session 1");
-    ASSERT_EQ(p.GetLifetimeType(), details::LifetimeModelType::kStrongCompact);
+    ASSERT_EQ(p.GetLifetimeType(), details::LifetimeModelType::kArena);
     expected_ops.emplace_back(
         1, utils::LifetimeOperationType::kInitializerListConstruction);
     ASSERT_TRUE(tracker.GetOperations() == expected_ops);
@@ -1079,50 +1475,275 @@ TEST(ProxyCreationTests,
   ASSERT_TRUE(tracker.GetOperations() == expected_ops);
 }
 
-TEST(ProxyCreationTests, TestMakeProxyShared_StrongCompact_Lifetime_Copy) {
+TEST(ProxyCreationTests, TestMakeProxyIn_Lifetime_Copy) {
   utils::LifetimeTracker tracker;
   std::vector<utils::LifetimeOperation> expected_ops;
+  pro::compact_arena arena{1024u};
   {
-    auto p1 = pro::make_proxy_shared<details::TestWeakSharedStringable,
-                                     utils::LifetimeTracker::Session>(&tracker);
+    auto p1 = pro::make_proxy_in<details::TestCompactStringable,
+                                 utils::LifetimeTracker::Session>(arena,
+                                                                  &tracker);
     expected_ops.emplace_back(1,
                               utils::LifetimeOperationType::kValueConstruction);
     auto p2 = p1;
     ASSERT_TRUE(p1.has_value());
     ASSERT_EQ(ToString(*p1), "Session 1");
-    ASSERT_EQ(p1.GetLifetimeType(), details::LifetimeModelType::kStrongCompact);
     ASSERT_TRUE(p2.has_value());
-    ASSERT_EQ(ToString(*p2), "Session 1");
-    ASSERT_EQ(p2.GetLifetimeType(), details::LifetimeModelType::kStrongCompact);
+    ASSERT_EQ(ToString(*p2), "Session 2");
+    ASSERT_EQ(p2.GetLifetimeType(), details::LifetimeModelType::kArena);
+    ASSERT_EQ(arena.size(), 2 * sizeof(utils::LifetimeTracker::Session));
+    expected_ops.emplace_back(2,
+                              utils::LifetimeOperationType::kCopyConstruction);
     ASSERT_TRUE(tracker.GetOperations() == expected_ops);
   }
+  expected_ops.emplace_back(2, utils::LifetimeOperationType::kDestruction);
   expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
   ASSERT_TRUE(tracker.GetOperations() == expected_ops);
 }
 
-TEST(ProxyCreationTests, TestMakeProxyShared_StrongCompact_Lifetime_Move) {
+TEST(ProxyCreationTests, TestMakeProxyIn_Lifetime_Move) {
   utils::LifetimeTracker tracker;
   std::vector<utils::LifetimeOperation> expected_ops;
+  pro::compact_arena arena{1024u};
   {
-    auto p1 = pro::make_proxy_shared<details::TestWeakSharedStringable,
-                                     utils::LifetimeTracker::Session>(&tracker);
+    auto p1 = pro::make_proxy_in<details::TestCompactStringable,
+                                 utils::LifetimeTracker::Session>(arena,
+                                                                  &tracker);
     expected_ops.emplace_back(1,
                               utils::LifetimeOperationType::kValueConstruction);
     auto p2 = std::move(p1);
     ASSERT_FALSE(p1.has_value());
     ASSERT_TRUE(p2.has_value());
     ASSERT_EQ(ToString(*p2), "Session 1");
-    ASSERT_EQ(p2.GetLifetimeType(), details::LifetimeModelType::kStrongCompact);
+    ASSERT_EQ(p2.GetLifetimeType(), details::LifetimeModelType::kArena);
     ASSERT_TRUE(tracker.GetOperations() == expected_ops);
   }
   expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
   ASSERT_TRUE(tracker.GetOperations() == expected_ops);
 }
 
-TEST(ProxyCreationTests,
-     TestMakeProxyShared_StrongCompact_Lifetime_WeakAccess) {
+TEST(ProxyCreationTests, TestMakeProxyIn_CapacityExceeded) {
+  pro::compact_arena arena{sizeof(utils::LifetimeTracker::Session)};
   utils::LifetimeTracker tracker;
-  std::vector<utils::LifetimeOperation> expected_ops;
+  auto p = pro::make_proxy_in<details::TestCompactStringable,
+                              utils::LifetimeTracker::Session>(arena, &tracker);
+  ASSERT_THROW((pro::make_proxy_in<details::TestCompactStringable,
+                                   utils::LifetimeTracker::Session>(arena,
+                                                                    &tracker)),
+               std::bad_alloc);
+  ASSERT_EQ(ToString(*p), "Session 1");
+}
+
+TEST(ProxyCreationTests, TestMakeProxyIn_ConcurrentArenas) {
+  // Identifiers of destroyed arenas are reused by arenas of other threads
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([i] {
+      for (int j = 0; j < 100; ++j) {
+        pro::compact_arena arena{64u};
+        auto p =
+            pro::make_proxy_in<details::TestCompactStringable>(arena, i * j);
+        ASSERT_EQ(ToString(*p), std::to_string(i * j));
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+}
+
+TEST(ProxyCreationTests, TestMakeProxyIn_ProxyArena_FromValue) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  utils::LifetimeTracker::Session session{&tracker};
+  expected_ops.emplace_back(1,
+                            utils::LifetimeOperationType::kValueConstruction);
+  pro::proxy_arena arena;
+  {
+    auto p = pro::make_proxy_in<details::TestLargeStringable>(arena, session);
+    ASSERT_TRUE(p.has_value());
+    ASSERT_EQ(ToString(*p), "Session 2");
+    ASSERT_EQ(p.GetLifetimeType(), details::LifetimeModelType::kProxyArena);
+    ASSERT_EQ(arena.size(), sizeof(utils::LifetimeTracker::Session));
+    expected_ops.emplace_back(2,
+                              utils::LifetimeOperationType::kCopyConstruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(2, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestMakeProxyIn_ProxyArena_InPlaceInitializerList) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  pro::proxy_arena arena;
+  {
+    auto p = pro::make_proxy_in<details::TestLargeStringable,
+                                utils::LifetimeTracker::Session>(
+        arena, {1, 2, 3}, &tracker);
+    ASSERT_TRUE(p.has_value());
+    ASSERT_EQ(ToString(*p), "Session 1");
+    ASSERT_EQ(p.GetLifetimeType(), details::LifetimeModelType::kProxyArena);
+    expected_ops.emplace_back(
+        1, utils::LifetimeOperationType::kInitializerListConstruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestMakeProxyIn_ProxyArena_Lifetime_Copy) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  pro::proxy_arena arena;
+  {
+    auto p1 = pro::make_proxy_in<details::TestLargeStringable,
+                                 utils::LifetimeTracker::Session>(arena,
+                                                                  &tracker);
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    auto p2 = p1;
+    ASSERT_EQ(ToString(*p1), "Session 1");
+    ASSERT_EQ(ToString(*p2), "Session 2");
+    ASSERT_EQ(p2.GetLifetimeType(), details::LifetimeModelType::kProxyArena);
+    ASSERT_EQ(arena.size(), 2 * sizeof(utils::LifetimeTracker::Session));
+    expected_ops.emplace_back(2,
+                              utils::LifetimeOperationType::kCopyConstruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(2, utils::LifetimeOperationType::kDestruction);
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestMakeProxyIn_ProxyArena_Release) {
+  pro::proxy_arena arena;
+  std::vector<pro::proxy<details::TestTrivialStringable>> v;
+  for (int i = 0; i < 3; ++i) {
+    v.push_back(pro::make_proxy_in<details::TestTrivialStringable>(arena, i));
+    v.push_back(pro::make_proxy_in<details::TestTrivialStringable>(
+        arena, details::LargeTrivialValue{{i + 10}}));
+  }
+  ASSERT_EQ(arena.size(),
+            3 * (sizeof(int) + sizeof(details::LargeTrivialValue)));
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_EQ(ToString(*v[2 * i]), std::to_string(i));
+    ASSERT_EQ(ToString(*v[2 * i + 1]), std::to_string(i + 10));
+  }
+  arena.release();
+  ASSERT_EQ(arena.size(), 0u);
+  // Destroying the proxies after the release is a no-op
+}
+
+TEST(ProxyCreationTests, TestCompact_Inplace) {
+  auto p = pro::make_proxy<details::TestCompactStringable>(123);
+  ASSERT_EQ(p.GetLifetimeType(), details::LifetimeModelType::kInplace);
+  ASSERT_EQ(ToString(*p), "123");
+  auto p2 = p;
+  p.reset();
+  ASSERT_FALSE(p.has_value());
+  ASSERT_EQ(ToString(*p2), "123");
+}
+
+TEST(ProxyCreationTests, TestMakeProxyShared_StrongCompact_FromValue) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  utils::LifetimeTracker::Session session{&tracker};
+  expected_ops.emplace_back(1,
+                            utils::LifetimeOperationType::kValueConstruction);
+  {
+    auto p = pro::make_proxy_shared<details::TestWeakSharedStringable>(session);
+    ASSERT_TRUE(p.has_value());
+    ASSERT_EQ(ToString(*p), "Session 2");
+    ASSERT_EQ(p.GetLifetimeType(), details::LifetimeModelType::kStrongCompact);
+    expected_ops.emplace_back(2,
+                              utils::LifetimeOperationType::kCopyConstruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(2, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestMakeProxyShared_StrongCompact_InPlace) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p = pro::make_proxy_shared<details::TestWeakSharedStringable,
+                                    utils::LifetimeTracker::Session>(&tracker);
+    ASSERT_TRUE(p.has_value());
+    ASSERT_EQ(ToString(*p), "Session 1");
+    ASSERT_EQ(p.GetLifetimeType(), details::LifetimeModelType::kStrongCompact);
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests,
+     TestMakeProxyShared_StrongCompact_InPlaceInitializerList) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p = pro::make_proxy_shared<details::TestWeakSharedStringable,
+                                    utils::LifetimeTracker::Session>({1, 2, 3},
+                                                                     &tracker);
+    ASSERT_TRUE(p.has_value());
+    ASSERT_EQ(ToString(*p), "Session 1");
+    ASSERT_EQ(p.GetLifetimeType(), details::LifetimeModelType::kStrongCompact);
+    expected_ops.emplace_back(
+        1, utils::LifetimeOperationType::kInitializerListConstruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestMakeProxyShared_StrongCompact_Lifetime_Copy) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p1 = pro::make_proxy_shared<details::TestWeakSharedStringable,
+                                     utils::LifetimeTracker::Session>(&tracker);
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    auto p2 = p1;
+    ASSERT_TRUE(p1.has_value());
+    ASSERT_EQ(ToString(*p1), "Session 1");
+    ASSERT_EQ(p1.GetLifetimeType(), details::LifetimeModelType::kStrongCompact);
+    ASSERT_TRUE(p2.has_value());
+    ASSERT_EQ(ToString(*p2), "Session 1");
+    ASSERT_EQ(p2.GetLifetimeType(), details::LifetimeModelType::kStrongCompact);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestMakeProxyShared_StrongCompact_Lifetime_Move) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p1 = pro::make_proxy_shared<details::TestWeakSharedStringable,
+                                     utils::LifetimeTracker::Session>(&tracker);
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    auto p2 = std::move(p1);
+    ASSERT_FALSE(p1.has_value());
+    ASSERT_TRUE(p2.has_value());
+    ASSERT_EQ(ToString(*p2), "Session 1");
+    ASSERT_EQ(p2.GetLifetimeType(), details::LifetimeModelType::kStrongCompact);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests,
+     TestMakeProxyShared_StrongCompact_Lifetime_WeakAccess) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
   {
     auto p1 = pro::make_proxy_shared<details::TestWeakSharedStringable,
                                      utils::LifetimeTracker::Session>(&tracker);
@@ -1173,6 +1794,414 @@ TEST(ProxyCreationTests,
   ASSERT_TRUE(tracker.GetOperations() == expected_ops);
 }
 
+TEST(ProxyCreationTests,
+     TestMakeProxyShared_StrongCompact_Lifetime_WeakBorrow) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p1 = pro::make_proxy_shared<details::TestWeakSharedStringable,
+                                     utils::LifetimeTracker::Session>(&tracker);
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    pro::weak_proxy<details::TestWeakSharedStringable> p2 = p1;
+    bool called = false;
+    ASSERT_TRUE(p2.with_locked(
+        [&](pro::proxy_view<details::TestWeakSharedStringable> view) {
+          called = true;
+          ASSERT_EQ(ToString(*view), "Session 1");
+          p1.reset();
+          // The borrowed value outlives the last strong reference
+          ASSERT_EQ(ToString(*view), "Session 1");
+          ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+        }));
+    ASSERT_TRUE(called);
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+    called = false;
+    ASSERT_FALSE(p2.with_locked(
+        [&](pro::proxy_view<details::TestWeakSharedStringable>) {
+          called = true;
+        }));
+    ASSERT_FALSE(called);
+  }
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestMakeProxyShared_StrongCompact_WeakBorrow_Nested) {
+  auto p1 = pro::make_proxy_shared<details::TestWeakSharedStringable>(123);
+  pro::weak_proxy<details::TestWeakSharedStringable> p2 = p1;
+  // Borrows beyond the slots of the thread fall back to a strong reference
+  int depth = 0;
+  auto borrow = [&](auto& self,
+                    pro::proxy_view<details::TestWeakSharedStringable> view) {
+    ASSERT_EQ(ToString(*view), "123");
+    if (++depth < 8) {
+      ASSERT_TRUE(p2.with_locked(
+          [&](pro::proxy_view<details::TestWeakSharedStringable> inner) {
+            self(self, std::move(inner));
+          }));
+    }
+  };
+  ASSERT_TRUE(p2.with_locked(
+      [&](pro::proxy_view<details::TestWeakSharedStringable> view) {
+        borrow(borrow, std::move(view));
+      }));
+  ASSERT_EQ(depth, 8);
+  p1.reset();
+  ASSERT_FALSE(p2.lock().has_value());
+}
+
+TEST(ProxyCreationTests,
+     TestMakeProxyShared_StrongCompact_WeakBorrow_ReleasedByOtherThread) {
+  constexpr int kIterations = 1000;
+  for (int i = 0; i < kIterations; ++i) {
+    auto p1 = pro::make_proxy_shared<details::TestWeakSharedStringable>(i);
+    pro::weak_proxy<details::TestWeakSharedStringable> p2 = p1;
+    std::thread t([&] { p1.reset(); });
+    std::string value;
+    bool locked = p2.with_locked(
+        [&](pro::proxy_view<details::TestWeakSharedStringable> view) {
+          value = ToString(*view);
+        });
+    t.join();
+    ASSERT_EQ(value, locked ? std::to_string(i) : std::string{});
+    ASSERT_FALSE(p2.with_locked(
+        [](pro::proxy_view<details::TestWeakSharedStringable>) {}));
+  }
+}
+
+TEST(ProxyCreationTests,
+     TestMakeProxySharedLocal_StrongCompact_Lifetime_WeakBorrow) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p1 =
+        pro::make_proxy_shared_local<details::TestWeakSharedStringable,
+                                     utils::LifetimeTracker::Session>(&tracker);
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    pro::weak_proxy<details::TestWeakSharedStringable> p2 = p1;
+    ASSERT_TRUE(p2.with_locked(
+        [&](pro::proxy_view<details::TestWeakSharedStringable> view) {
+          p1.reset();
+          // Only the slots of the calling thread are checked
+          ASSERT_EQ(ToString(*view), "Session 1");
+          ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+        }));
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+    ASSERT_FALSE(p2.with_locked(
+        [](pro::proxy_view<details::TestWeakSharedStringable>) {}));
+  }
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestMakeProxySharedLocal_SharedCompact_Lifetime_Copy) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p1 =
+        pro::make_proxy_shared_local<details::TestSharedStringable,
+                                     utils::LifetimeTracker::Session>(&tracker);
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    auto p2 = p1;
+    auto p3 = std::move(p1);
+    ASSERT_FALSE(p1.has_value());
+    ASSERT_EQ(ToString(*p2), "Session 1");
+    ASSERT_EQ(p2.GetLifetimeType(),
+              details::LifetimeModelType::kLocalSharedCompact);
+    p2.reset();
+    ASSERT_EQ(ToString(*p3), "Session 1");
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests,
+     TestMakeProxySharedLocal_StrongCompact_Lifetime_WeakAccess) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p1 =
+        pro::make_proxy_shared_local<details::TestWeakSharedStringable,
+                                     utils::LifetimeTracker::Session>(&tracker);
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    pro::weak_proxy<details::TestWeakSharedStringable> p2 = p1;
+    auto p3 = p2.lock();
+    ASSERT_TRUE(p3.has_value());
+    ASSERT_EQ(ToString(*p3), "Session 1");
+    ASSERT_EQ(p3.GetLifetimeType(),
+              details::LifetimeModelType::kLocalStrongCompact);
+    p3.reset();
+    p1.reset();
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+    auto p4 = p2.lock();
+    ASSERT_FALSE(p4.has_value());
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestAllocateProxySharedLocal_SharedCompact_FromValue) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  utils::LifetimeTracker::Session session{&tracker};
+  expected_ops.emplace_back(1,
+                            utils::LifetimeOperationType::kValueConstruction);
+  {
+    std::pmr::unsynchronized_pool_resource memory_pool;
+    auto p = pro::allocate_proxy_shared_local<details::TestSharedStringable>(
+        std::pmr::polymorphic_allocator<>{&memory_pool}, session);
+    ASSERT_EQ(ToString(*p), "Session 2");
+    ASSERT_EQ(p.GetLifetimeType(),
+              details::LifetimeModelType::kLocalSharedCompact);
+    expected_ops.emplace_back(2,
+                              utils::LifetimeOperationType::kCopyConstruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(2, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests,
+     TestMakeProxySharedBiased_SharedCompact_Lifetime_Copy) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p1 =
+        pro::make_proxy_shared_biased<details::TestSharedStringable,
+                                      utils::LifetimeTracker::Session>(
+            &tracker);
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    auto p2 = p1;
+    ASSERT_EQ(p2.GetLifetimeType(),
+              details::LifetimeModelType::kBiasedSharedCompact);
+    p1.reset();
+    ASSERT_EQ(ToString(*p2), "Session 1");
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests,
+     TestMakeProxySharedBiased_SharedCompact_Lifetime_ReleasedByOtherThread) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  auto p1 = pro::make_proxy_shared_biased<details::TestSharedStringable,
+                                          utils::LifetimeTracker::Session>(
+      &tracker);
+  expected_ops.emplace_back(1,
+                            utils::LifetimeOperationType::kValueConstruction);
+  auto p2 = p1;
+  std::thread([&] {
+    auto p3 = p2;
+    ASSERT_EQ(ToString(*p3), "Session 1");
+    p2.reset();
+  }).join();
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  p1.reset();
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests,
+     TestMakeProxySharedBiased_SharedCompact_Lifetime_HandedOff) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  auto p1 = pro::make_proxy_shared_biased<details::TestSharedStringable,
+                                          utils::LifetimeTracker::Session>(
+      &tracker);
+  expected_ops.emplace_back(1,
+                            utils::LifetimeOperationType::kValueConstruction);
+  std::thread([p2 = std::move(p1)]() mutable { p2.reset(); }).join();
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  // The reference released by the other thread is merged the next time this
+  // thread creates a biased proxy
+  auto p3 = pro::make_proxy_shared_biased<details::TestSharedStringable>(123);
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests,
+     TestMakeProxySharedBiased_SharedCompact_Lifetime_OwnerExited) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  pro::proxy<details::TestSharedStringable> p1;
+  std::thread([&] {
+    p1 = pro::make_proxy_shared_biased<details::TestSharedStringable,
+                                       utils::LifetimeTracker::Session>(
+        &tracker);
+  }).join();
+  expected_ops.emplace_back(1,
+                            utils::LifetimeOperationType::kValueConstruction);
+  auto p2 = p1;
+  p1.reset();
+  ASSERT_EQ(ToString(*p2), "Session 1");
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  p2.reset();
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests,
+     TestMakeProxySharedBiased_StrongCompact_Lifetime_WeakAccess) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p1 =
+        pro::make_proxy_shared_biased<details::TestWeakSharedStringable,
+                                      utils::LifetimeTracker::Session>(
+            &tracker);
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    pro::weak_proxy<details::TestWeakSharedStringable> p2 = p1;
+    std::thread([&] {
+      auto p3 = p2.lock();
+      ASSERT_TRUE(p3.has_value());
+      ASSERT_EQ(ToString(*p3), "Session 1");
+      ASSERT_EQ(p3.GetLifetimeType(),
+                details::LifetimeModelType::kBiasedStrongCompact);
+    }).join();
+    p1.reset();
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+    std::thread([&] { ASSERT_FALSE(p2.lock().has_value()); }).join();
+    ASSERT_FALSE(p2.lock().has_value());
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests,
+     TestMakeProxySharedDeferred_SharedCompact_Lifetime_Copy) {
+  pro::reclaim();
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p1 =
+        pro::make_proxy_shared_deferred<details::TestSharedStringable,
+                                        utils::LifetimeTracker::Session>(
+            &tracker);
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    auto p2 = p1;
+    ASSERT_EQ(p2.GetLifetimeType(),
+              details::LifetimeModelType::kDeferredSharedCompact);
+    p1.reset();
+    ASSERT_EQ(ToString(*p2), "Session 1");
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  pro::reclaim();
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  // The value is not destroyed twice
+  pro::reclaim();
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests,
+     TestMakeProxySharedDeferred_SharedCompact_Lifetime_ReleasedByOtherThread) {
+  pro::reclaim();
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  auto p1 = pro::make_proxy_shared_deferred<details::TestSharedStringable,
+                                            utils::LifetimeTracker::Session>(
+      &tracker);
+  expected_ops.emplace_back(1,
+                            utils::LifetimeOperationType::kValueConstruction);
+  std::thread([p2 = std::move(p1)]() mutable { p2.reset(); }).join();
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  pro::reclaim();
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests,
+     TestMakeProxySharedDeferred_SharedCompact_Lifetime_ActiveGuard) {
+  pro::reclaim();
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    pro::details::epoch_guard guard;
+    auto p = pro::make_proxy_shared_deferred<details::TestSharedStringable,
+                                             utils::LifetimeTracker::Session>(
+        &tracker);
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    p.reset();
+    // The guard may still be reading the value
+    pro::reclaim();
+    std::thread([] { pro::reclaim(); }).join();
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  pro::reclaim();
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests,
+     TestMakeProxySharedDeferred_StrongCompact_Lifetime_WeakAccess) {
+  pro::reclaim();
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p1 =
+        pro::make_proxy_shared_deferred<details::TestWeakSharedStringable,
+                                        utils::LifetimeTracker::Session>(
+            &tracker);
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    pro::weak_proxy<details::TestWeakSharedStringable> p2 = p1;
+    auto p3 = p2.lock();
+    ASSERT_TRUE(p3.has_value());
+    ASSERT_EQ(p3.GetLifetimeType(),
+              details::LifetimeModelType::kDeferredStrongCompact);
+    p3.reset();
+    p1.reset();
+    // Locking fails as soon as the last strong reference is released, even
+    // though the value is not destroyed yet
+    ASSERT_FALSE(p2.lock().has_value());
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+    pro::reclaim();
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests,
+     TestMakeProxySharedDeferred_StrongCompact_Lifetime_WeakBorrow) {
+  pro::reclaim();
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p1 =
+        pro::make_proxy_shared_deferred<details::TestWeakSharedStringable,
+                                        utils::LifetimeTracker::Session>(
+            &tracker);
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    pro::weak_proxy<details::TestWeakSharedStringable> p2 = p1;
+    ASSERT_TRUE(p2.with_locked(
+        [&](pro::proxy_view<details::TestWeakSharedStringable> view) {
+          p1.reset();
+          std::thread([] { pro::reclaim(); }).join();
+          ASSERT_EQ(ToString(*view), "Session 1");
+          ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+        }));
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+    ASSERT_FALSE(p2.with_locked(
+        [](pro::proxy_view<details::TestWeakSharedStringable>) {}));
+  }
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
 TEST(ProxyCreationTests, TestStdWeakPtrCompatibility) {
   utils::LifetimeTracker tracker;
   std::vector<utils::LifetimeOperation> expected_ops;
@@ -1197,6 +2226,29 @@ TEST(ProxyCreationTests, TestStdWeakPtrCompatibility) {
   ASSERT_TRUE(tracker.GetOperations() == expected_ops);
 }
 
+TEST(ProxyCreationTests, TestStdWeakPtrCompatibility_WeakBorrow) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    pro::proxy<details::TestWeakSharedStringable> p1 =
+        std::make_shared<utils::LifetimeTracker::Session>(&tracker);
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    pro::weak_proxy<details::TestWeakSharedStringable> p2 = p1;
+    ASSERT_TRUE(p2.with_locked(
+        [&](pro::proxy_view<details::TestWeakSharedStringable> view) {
+          p1.reset();
+          ASSERT_EQ(ToString(*view), "Session 1");
+          ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+        }));
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+    ASSERT_FALSE(p2.with_locked(
+        [](pro::proxy_view<details::TestWeakSharedStringable>) {}));
+  }
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
 TEST(ProxyCreationTests, TestMakeProxyView) {
   struct TestFacade
       : pro::facade_builder //
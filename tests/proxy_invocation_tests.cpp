@@ -3,11 +3,14 @@
 
 #include <algorithm>
 #include <functional>
+#include <iterator>
 #include <gtest/gtest.h>
 #include <iomanip>
 #include <list>
 #include <map>
+#include <memory>
 #include <ranges>
+#include <span>
 #include <sstream>
 #include <string>
 #include <typeindex>
@@ -38,6 +41,12 @@ struct Callable : pro::facade_builder                               //
                   ::add_facade<MovableCallable<Os...>>              //
                   ::build {};
 
+template <class... Os>
+struct StatelessCallable : pro::facade_builder                 //
+                           ::add_facade<Callable<Os...>>       //
+                           ::add_skill<pro::skills::stateless> //
+                           ::build {};
+
 template <class... Os>
 struct WeakCallable
     : pro::facade_builder                               //
@@ -164,6 +173,100 @@ PRO_DEF_FREE_DISPATCH(FreeDump, Dump);
 PRO_DEF_FREE_DISPATCH(FreeInvoke, std::invoke, Invoke);
 PRO_DEF_FREE_AS_MEM_DISPATCH(MemInvoke, std::invoke, Invoke);
 
+PRO_DEF_MEM_DISPATCH(MemAdd, Add);
+PRO_DEF_MEM_DISPATCH(MemGet, Get);
+
+struct Accumulator : pro::facade_builder                   //
+                     ::add_convention<MemAdd, void(int)>   //
+                     ::add_convention<MemGet, int() const> //
+                     ::build {};
+
+struct RvalueAccumulator : pro::facade_builder                    //
+                           ::add_convention<MemAdd, void(int&&)> //
+                           ::build {};
+
+struct InlineMetaAccumulator : pro::facade_builder       //
+                               ::add_facade<Accumulator> //
+                               ::inline_meta<3>          //
+                               ::build {};
+
+struct HotAccumulator : pro::facade_builder                            //
+                        ::add_hot_convention<MemAdd, void(int)>        //
+                        ::add_convention<MemGet, int() const>          //
+                        ::support_copy<pro::constraint_level::nothrow> //
+                        ::add_skill<pro::skills::rtti>                 //
+                        ::build {};
+
+struct PooledAccumulator : pro::facade_builder                            //
+                           ::add_facade<Accumulator>                      //
+                           ::support_copy<pro::constraint_level::nothrow> //
+                           ::add_skill<pro::skills::pooled_meta>          //
+                           ::build {};
+
+struct SharedAccumulator
+    : pro::facade_builder                                  //
+      ::add_facade<Accumulator>                            //
+      ::support_copy<pro::constraint_level::nothrow>       //
+      ::support_relocation<pro::constraint_level::nothrow> //
+      ::add_skill<pro::skills::shared_meta>                //
+      ::build {};
+
+struct SharedUniqueAccumulator : pro::facade_builder                   //
+                                 ::add_facade<Accumulator>             //
+                                 ::add_skill<pro::skills::shared_meta> //
+                                 ::build {};
+
+struct RegisterAccumulator
+    : pro::facade_builder                         //
+      ::add_facade<Accumulator>                   //
+      ::add_skill<pro::skills::register_dispatch> //
+      ::build {};
+
+template <int Scale>
+struct ScaledAccumulator {
+  void Add(int v) noexcept { value += v * Scale; }
+  int Get() const noexcept { return value; }
+  int value = 0;
+};
+
+// Aligned to a word, so that the low bits of its address can hold a tag
+template <int Scale>
+struct alignas(void*) AlignedAccumulator : ScaledAccumulator<Scale> {};
+
+template <class T>
+void Renew(std::unique_ptr<T>& p) {
+  p = std::make_unique<T>();
+}
+template <class T>
+int Take(std::unique_ptr<T>&& p) {
+  std::unique_ptr<T> taken = std::move(p);
+  return taken->Get();
+}
+PRO_DEF_FREE_DISPATCH(FreeRenew, Renew);
+PRO_DEF_FREE_DISPATCH(FreeTake, Take);
+
+struct TaggedAccumulator : pro::facade_builder                         //
+                           ::add_convention<MemAdd, void(int)>         //
+                           ::add_convention<MemGet, int() const>       //
+                           ::add_direct_convention<FreeRenew, void()>  //
+                           ::add_direct_convention<FreeTake, int() &&> //
+                           ::add_skill<pro::skills::tagged>            //
+                           ::build {};
+
+template <class F>
+concept BatchGettable = requires(const pro::proxy_batch<F>& b) { b.Get(); };
+
+template <class F, class D, class O, class... Args>
+concept BatchInvocable =
+    requires(std::span<pro::proxy<F>> proxies, Args... args) {
+      pro::proxy_invoke_batch<D, O>(proxies, args...);
+    };
+template <class F, class D, class O, class... Args>
+concept ConstBatchInvocable =
+    requires(std::span<const pro::proxy<F>> proxies, Args... args) {
+      pro::proxy_invoke_batch<D, O>(proxies, args...);
+    };
+
 } // namespace proxy_invocation_tests_details
 
 namespace details = proxy_invocation_tests_details;
@@ -442,3 +545,282 @@ TEST(ProxyInvocationTests, TestQualifiedConvention_Free) {
   ASSERT_EQ(Dump(*std::move(std::as_const(p))),
             "is_const=true, is_ref=false, value=123");
 }
+
+TEST(ProxyInvocationTests, TestBatch_Void) {
+  std::vector<pro::proxy<details::Accumulator>> v;
+  for (int scale : {1, 1, 2, 2, 2, 1}) {
+    if (scale == 1) {
+      v.push_back(pro::make_proxy<details::Accumulator,
+                                  details::ScaledAccumulator<1>>());
+    } else {
+      v.push_back(pro::make_proxy<details::Accumulator,
+                                  details::ScaledAccumulator<2>>());
+    }
+  }
+  pro::proxy_invoke_batch<details::MemAdd, void(int)>(std::span{v}, 3);
+  std::vector<int> results;
+  for (auto& p : v) {
+    results.push_back(p->Get());
+  }
+  ASSERT_EQ(results, (std::vector<int>{3, 3, 6, 6, 6, 3}));
+}
+
+TEST(ProxyInvocationTests, TestBatch_OutputIterator) {
+  std::vector<pro::proxy<details::Accumulator>> v;
+  for (int i = 0; i < 4; ++i) {
+    v.push_back(pro::make_proxy<details::Accumulator,
+                                details::ScaledAccumulator<1>>());
+    v.back()->Add(i);
+  }
+  v.push_back(
+      pro::make_proxy<details::Accumulator, details::ScaledAccumulator<2>>());
+  v.back()->Add(5);
+  std::vector<int> results;
+  auto out = pro::proxy_invoke_batch<details::MemGet, int() const>(
+      std::span<const pro::proxy<details::Accumulator>>{v},
+      std::back_inserter(results));
+  *out = 42;
+  ASSERT_EQ(results, (std::vector<int>{0, 1, 2, 3, 10, 42}));
+}
+
+TEST(ProxyInvocationTests, TestBatch_Accessor) {
+  std::vector<pro::proxy<details::Accumulator>> v;
+  v.push_back(
+      pro::make_proxy<details::Accumulator, details::ScaledAccumulator<1>>());
+  v.push_back(
+      pro::make_proxy<details::Accumulator, details::ScaledAccumulator<2>>());
+  v.push_back(
+      pro::make_proxy<details::Accumulator, details::ScaledAccumulator<2>>());
+  pro::proxy_batch<details::Accumulator> batch{v};
+  batch.Add(1);
+  batch.Add(2);
+  static_assert(!details::BatchGettable<details::Accumulator>);
+  ASSERT_EQ(v[0]->Get(), 3);
+  ASSERT_EQ(v[1]->Get(), 6);
+  ASSERT_EQ(v[2]->Get(), 6);
+}
+
+TEST(ProxyInvocationTests, TestBatch_Constraints) {
+  static_assert(
+      details::BatchInvocable<details::Accumulator, details::MemAdd, void(int),
+                              int>);
+  static_assert(!details::ConstBatchInvocable<details::Accumulator,
+                                              details::MemAdd, void(int), int>);
+  static_assert(
+      details::ConstBatchInvocable<details::Accumulator, details::MemGet,
+                                   int() const, int*>);
+  static_assert(
+      !details::BatchInvocable<details::RvalueAccumulator, details::MemAdd,
+                               void(int&&), int>);
+  static_assert(
+      !details::BatchInvocable<details::TaggedAccumulator, details::FreeTake,
+                               int() &&, int*>);
+}
+
+TEST(ProxyInvocationTests, TestBatch_DirectMeta) {
+  using TestFacade = details::MovableCallable<void(int&)>;
+  std::vector<pro::proxy<TestFacade>> v;
+  for (int i = 0; i < 3; ++i) {
+    v.push_back(pro::make_proxy<TestFacade>([](int& x) { x += 1; }));
+    v.push_back(pro::make_proxy<TestFacade>([](int& x) { x *= 2; }));
+    v.push_back(pro::make_proxy<TestFacade>([](int& x) { x *= 2; }));
+  }
+  int value = 0;
+  pro::proxy_batch<TestFacade> batch{v};
+  batch(value);
+  ASSERT_EQ(value, 84);
+  value = 1;
+  pro::proxy_invoke_batch<pro::operator_dispatch<"()">, void(int&)>(
+      std::span{v}.subspan(1), value);
+  ASSERT_EQ(value, 84);
+}
+
+TEST(ProxyInvocationTests, TestInlineMeta) {
+  static_assert(sizeof(pro::proxy<details::InlineMetaAccumulator>) ==
+                5 * sizeof(void*));
+  std::vector<pro::proxy<details::InlineMetaAccumulator>> v;
+  v.push_back(pro::make_proxy<details::InlineMetaAccumulator,
+                              details::ScaledAccumulator<1>>());
+  v.push_back(pro::make_proxy<details::InlineMetaAccumulator,
+                              details::ScaledAccumulator<2>>());
+  v.push_back(pro::make_proxy<details::InlineMetaAccumulator,
+                              details::ScaledAccumulator<2>>());
+  pro::proxy_invoke_batch<details::MemAdd, void(int)>(std::span{v}, 2);
+  v[0]->Add(1);
+  pro::proxy<details::InlineMetaAccumulator> p = std::move(v[1]);
+  ASSERT_FALSE(v[1].has_value());
+  ASSERT_EQ(v[0]->Get(), 3);
+  ASSERT_EQ(p->Get(), 4);
+  ASSERT_EQ(v[2]->Get(), 4);
+  p.reset();
+  ASSERT_FALSE(p.has_value());
+}
+
+TEST(ProxyInvocationTests, TestHotConvention) {
+  // The dispatcher of MemAdd and a pointer to the rest of the meta
+  static_assert(sizeof(pro::proxy<details::HotAccumulator>) ==
+                4 * sizeof(void*));
+  std::vector<pro::proxy<details::HotAccumulator>> v;
+  v.push_back(pro::make_proxy<details::HotAccumulator,
+                              details::ScaledAccumulator<1>>());
+  v.push_back(pro::make_proxy<details::HotAccumulator,
+                              details::ScaledAccumulator<2>>());
+  v.push_back(pro::make_proxy<details::HotAccumulator,
+                              details::ScaledAccumulator<2>>());
+  pro::proxy_invoke_batch<details::MemAdd, void(int)>(std::span{v}, 2);
+  v[0]->Add(1);
+  pro::proxy<details::HotAccumulator> p = v[1];
+  p->Add(1);
+  ASSERT_EQ(v[0]->Get(), 3);
+  ASSERT_EQ(v[1]->Get(), 4);
+  ASSERT_EQ(p->Get(), 6);
+  ASSERT_EQ(proxy_typeid(*p), typeid(details::ScaledAccumulator<2>));
+  p = std::move(v[0]);
+  ASSERT_FALSE(v[0].has_value());
+  ASSERT_EQ(p->Get(), 3);
+}
+
+TEST(ProxyInvocationTests, TestPooledMeta) {
+  std::vector<pro::proxy<details::PooledAccumulator>> v;
+  v.push_back(pro::make_proxy<details::PooledAccumulator,
+                              details::ScaledAccumulator<1>>());
+  v.push_back(pro::make_proxy<details::PooledAccumulator,
+                              details::ScaledAccumulator<2>>());
+  v.push_back(pro::make_proxy<details::PooledAccumulator,
+                              details::ScaledAccumulator<2>>());
+  pro::proxy_invoke_batch<details::MemAdd, void(int)>(std::span{v}, 2);
+  pro::proxy<details::PooledAccumulator> p = v[1];
+  p->Add(1);
+  ASSERT_EQ(v[0]->Get(), 2);
+  ASSERT_EQ(v[1]->Get(), 4);
+  ASSERT_EQ(v[2]->Get(), 4);
+  ASSERT_EQ(p->Get(), 6);
+  p = std::move(v[0]);
+  ASSERT_FALSE(v[0].has_value());
+  ASSERT_EQ(p->Get(), 2);
+}
+
+TEST(ProxyInvocationTests, TestSharedMeta) {
+  static_assert(sizeof(pro::proxy<details::SharedAccumulator>) ==
+                sizeof(pro::proxy<details::Accumulator>));
+  std::vector<pro::proxy<details::SharedAccumulator>> v;
+  v.push_back(pro::make_proxy<details::SharedAccumulator,
+                              details::ScaledAccumulator<1>>());
+  v.push_back(pro::make_proxy<details::SharedAccumulator,
+                              details::ScaledAccumulator<2>>());
+  v.push_back(pro::make_proxy<details::SharedAccumulator,
+                              details::ScaledAccumulator<2>>());
+  pro::proxy_invoke_batch<details::MemAdd, void(int)>(std::span{v}, 2);
+  pro::proxy<details::SharedAccumulator> p = v[1];
+  p->Add(1);
+  ASSERT_EQ(v[0]->Get(), 2);
+  ASSERT_EQ(v[1]->Get(), 4);
+  ASSERT_EQ(v[2]->Get(), 4);
+  ASSERT_EQ(p->Get(), 6);
+  p = std::move(v[0]);
+  ASSERT_FALSE(v[0].has_value());
+  ASSERT_EQ(p->Get(), 2);
+
+  // Facades with the same conventions share the invocation metas of a type
+  auto q = pro::make_proxy<details::SharedUniqueAccumulator,
+                           details::ScaledAccumulator<1>>();
+  q->Add(3);
+  ASSERT_EQ(q->Get(), 3);
+  using pro::details::proxy_helper;
+  ASSERT_EQ(
+      (&proxy_helper::get_invocation_meta<false, details::MemAdd, void(int)>(
+          p)),
+      (&proxy_helper::get_invocation_meta<false, details::MemAdd, void(int)>(
+          q)));
+}
+
+TEST(ProxyInvocationTests, TestTaggedProxy) {
+  static_assert(sizeof(pro::proxy<details::TaggedAccumulator>) ==
+                sizeof(void*));
+  // The address of an int-aligned object may not leave room for a tag
+  static_assert(!pro::proxiable<details::ScaledAccumulator<1>*,
+                                details::TaggedAccumulator>);
+  static_assert(!pro::proxiable<std::unique_ptr<details::ScaledAccumulator<1>>,
+                                details::TaggedAccumulator>);
+  std::vector<pro::proxy<details::TaggedAccumulator>> v;
+  v.push_back(std::make_unique<details::AlignedAccumulator<1>>());
+  v.push_back(std::make_unique<details::AlignedAccumulator<2>>());
+  v.push_back(std::make_unique<details::AlignedAccumulator<2>>());
+  for (auto& p : v) {
+    p->Add(2);
+  }
+  ASSERT_EQ(v[0]->Get(), 2);
+  ASSERT_EQ(v[1]->Get(), 4);
+  Renew(v[1]);
+  ASSERT_EQ(v[1]->Get(), 0);
+  v[1]->Add(1);
+  ASSERT_EQ(v[1]->Get(), 2);
+  ASSERT_EQ(Take(std::move(v[2])), 4);
+  ASSERT_FALSE(v[2].has_value());
+  pro::proxy<details::TaggedAccumulator> p = std::move(v[0]);
+  ASSERT_FALSE(v[0].has_value());
+  ASSERT_EQ(p->Get(), 2);
+  swap(p, v[1]);
+  ASSERT_EQ(p->Get(), 2);
+  ASSERT_EQ(v[1]->Get(), 2);
+  p.reset();
+  ASSERT_FALSE(p.has_value());
+}
+
+TEST(ProxyInvocationTests, TestRegisterDispatch) {
+  static_assert(pro::proxiable<details::ScaledAccumulator<1>*,
+                               details::RegisterAccumulator>);
+  // Not trivially copyable
+  static_assert(!pro::proxiable<std::unique_ptr<details::ScaledAccumulator<1>>,
+                                details::RegisterAccumulator>);
+  details::ScaledAccumulator<1> a;
+  details::ScaledAccumulator<2> b;
+  std::vector<pro::proxy<details::RegisterAccumulator>> v;
+  v.push_back(&a);
+  v.push_back(&b);
+  v.push_back(&b);
+  pro::proxy_invoke_batch<details::MemAdd, void(int)>(std::span{v}, 1);
+  v[0]->Add(2);
+  ASSERT_EQ(a.value, 3);
+  ASSERT_EQ(b.value, 4);
+  ASSERT_EQ(v[1]->Get(), 4);
+  // Views keep the calling convention only if their facade opted in
+  static_assert(pro::details::instantiated_t<
+                pro::details::register_dispatch_traits,
+                pro::observer_facade<
+                    details::RegisterAccumulator>::reflection_types>::value);
+  static_assert(!pro::details::instantiated_t<
+                pro::details::register_dispatch_traits,
+                pro::observer_facade<details::Accumulator>::reflection_types>::
+                    value);
+  pro::proxy_view<details::RegisterAccumulator> view =
+      pro::make_proxy_view<details::RegisterAccumulator>(a);
+  view->Add(1);
+  ASSERT_EQ(view->Get(), 4);
+  ASSERT_EQ(a.value, 4);
+}
+
+TEST(ProxyInvocationTests, TestStatelessProxy) {
+  using TestFacade = details::StatelessCallable<int(int) const>;
+  static_assert(sizeof(pro::proxy<TestFacade>) == sizeof(void*));
+  int offset = 1;
+  auto stateful = [offset](int x) { return x + offset; };
+  static_assert(!pro::inplace_proxiable_target<decltype(stateful), TestFacade>);
+  std::vector<pro::proxy<TestFacade>> v;
+  v.push_back(pro::make_proxy<TestFacade>([](int x) { return x + 1; }));
+  v.push_back(pro::make_proxy<TestFacade>([](int x) { return x * 2; }));
+  v.push_back(v[1]);
+  std::vector<int> results;
+  for (auto& p : v) {
+    results.push_back((*p)(3));
+  }
+  ASSERT_EQ(results, (std::vector<int>{4, 6, 6}));
+  pro::proxy<TestFacade> p = std::move(v[0]);
+  ASSERT_FALSE(v[0].has_value());
+  ASSERT_EQ((*p)(3), 4);
+  swap(p, v[1]);
+  ASSERT_EQ((*p)(3), 6);
+  ASSERT_EQ((*v[1])(3), 4);
+  p.reset();
+  ASSERT_FALSE(p.has_value());
+}
@@ -25,11 +25,44 @@ struct TestTrivialFacade
       ::support_destruction<pro::constraint_level::trivial> //
       ::build {};
 
+struct TestNontrivialFacade
+    : pro::facade_builder                                        //
+      ::add_convention<utils::spec::FreeToString, std::string()> //
+      ::support_copy<pro::constraint_level::nontrivial>          //
+      ::support_relocation<pro::constraint_level::nontrivial>    //
+      ::build {};
+
 struct TestRttiFacade : pro::facade_builder                           //
                         ::add_direct_reflection<utils::RttiReflector> //
                         ::add_facade<TestFacade, true>                //
                         ::build {};
 
+struct TestInPlaceAssignmentFacade
+    : pro::facade_builder                                        //
+      ::add_convention<utils::spec::FreeToString, std::string()> //
+      ::support_relocation<pro::constraint_level::nontrivial>    //
+      ::support_copy<pro::constraint_level::nontrivial>          //
+      ::add_skill<pro::skills::in_place_assignment>              //
+      ::build {};
+
+// Counts the copy assignments of all instances sharing `assignments`.
+struct AssignmentCounter {
+  AssignmentCounter(int value, int* assignments)
+      : value(value), assignments(assignments) {}
+  AssignmentCounter(const AssignmentCounter&) = default;
+  AssignmentCounter& operator=(const AssignmentCounter& rhs) {
+    value = rhs.value;
+    ++*assignments;
+    return *this;
+  }
+  friend std::string to_string(const AssignmentCounter& self) {
+    return std::to_string(self.value);
+  }
+
+  int value;
+  int* assignments;
+};
+
 // Additional static asserts for substitution
 static_assert(!std::is_convertible_v<pro::proxy<TestTrivialFacade>,
                                      pro::proxy<utils::spec::Stringable>>);
@@ -1243,3 +1276,160 @@ TEST(ProxyLifetimeTests, Test_MoveSubstitution_FromNull) {
   ASSERT_FALSE(p1.has_value());
   ASSERT_FALSE(p2.has_value());
 }
+
+TEST(ProxyLifetimeTests, TestInPlaceAssignment_SameType) {
+  int assignments = 0;
+  std::allocator<void> alloc;
+  auto p1 = pro::allocate_proxy<details::TestInPlaceAssignmentFacade,
+                                details::AssignmentCounter>(alloc, 1,
+                                                            &assignments);
+  auto p2 = pro::allocate_proxy<details::TestInPlaceAssignmentFacade,
+                                details::AssignmentCounter>(alloc, 2,
+                                                            &assignments);
+  p1 = p2;
+  ASSERT_EQ(assignments, 1);
+  ASSERT_EQ(ToString(*p1), "2");
+  ASSERT_EQ(ToString(*p2), "2");
+  auto p3 = pro::make_proxy_inplace<details::TestInPlaceAssignmentFacade,
+                                    details::AssignmentCounter>(3,
+                                                                &assignments);
+  auto p4 = pro::make_proxy_inplace<details::TestInPlaceAssignmentFacade,
+                                    details::AssignmentCounter>(4,
+                                                                &assignments);
+  p3 = p4;
+  ASSERT_EQ(assignments, 2);
+  ASSERT_EQ(ToString(*p3), "4");
+}
+
+TEST(ProxyLifetimeTests, TestInPlaceAssignment_DifferentTypes) {
+  int assignments = 0;
+  auto p1 = pro::make_proxy<details::TestInPlaceAssignmentFacade,
+                            details::AssignmentCounter>(1, &assignments);
+  auto p2 = pro::make_proxy<details::TestInPlaceAssignmentFacade>(2);
+  p1 = p2;
+  ASSERT_EQ(assignments, 0);
+  ASSERT_EQ(ToString(*p1), "2");
+  p2 = nullptr;
+  p1 = p2;
+  ASSERT_FALSE(p1.has_value());
+}
+
+TEST(ProxyLifetimeTests, TestInPlaceAssignment_NotAssignable) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    pro::proxy<details::TestInPlaceAssignmentFacade> p1{
+        std::in_place_type<utils::LifetimeTracker::Session>, &tracker};
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    pro::proxy<details::TestInPlaceAssignmentFacade> p2{
+        std::in_place_type<utils::LifetimeTracker::Session>, &tracker};
+    expected_ops.emplace_back(2,
+                              utils::LifetimeOperationType::kValueConstruction);
+    p1 = p2;
+    ASSERT_EQ(ToString(*p1), "Session 4");
+    expected_ops.emplace_back(3,
+                              utils::LifetimeOperationType::kCopyConstruction);
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+    expected_ops.emplace_back(4,
+                              utils::LifetimeOperationType::kMoveConstruction);
+    expected_ops.emplace_back(3, utils::LifetimeOperationType::kDestruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(2, utils::LifetimeOperationType::kDestruction);
+  expected_ops.emplace_back(4, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyLifetimeTests, TestInPlaceAssignment_Swap) {
+  int assignments = 0;
+  std::allocator<void> alloc;
+  auto p1 = pro::allocate_proxy<details::TestInPlaceAssignmentFacade,
+                                details::AssignmentCounter>(alloc, 1,
+                                                            &assignments);
+  auto p2 = pro::allocate_proxy<details::TestInPlaceAssignmentFacade,
+                                details::AssignmentCounter>(alloc, 2,
+                                                            &assignments);
+  swap(p1, p2);
+  ASSERT_EQ(assignments, 0);
+  ASSERT_EQ(ToString(*p1), "2");
+  ASSERT_EQ(ToString(*p2), "1");
+  auto p3 = pro::make_proxy<details::TestInPlaceAssignmentFacade>(3);
+  swap(p1, p3);
+  ASSERT_EQ(ToString(*p1), "3");
+  ASSERT_EQ(ToString(*p3), "2");
+}
+
+TEST(ProxyLifetimeTests, TestTrivialPayload_NontrivialFacade) {
+  using Proxy = pro::proxy<details::TestNontrivialFacade>;
+  using Flags = pro::details::lifetime_flags_meta;
+  using Helper = pro::details::proxy_helper;
+  static_assert(pro::details::facade_meta_ptr_traits<
+                details::TestNontrivialFacade>::has_lifetime_flags);
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    utils::LifetimeTracker::Session session{&tracker};
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    pro::proxy<details::TestNontrivialFacade> p1 = &session;
+    pro::proxy<details::TestNontrivialFacade> p2{
+        std::in_place_type<utils::LifetimeTracker::Session>, &tracker};
+    expected_ops.emplace_back(2,
+                              utils::LifetimeOperationType::kValueConstruction);
+    // Only the raw pointer skips the dispatchers of the lifetime conventions
+    ASSERT_TRUE(Helper::has_lifetime_flag<&Flags::trivially_copyable>(p1));
+    ASSERT_TRUE(Helper::has_lifetime_flag<&Flags::trivially_relocatable>(p1));
+    ASSERT_TRUE(Helper::has_lifetime_flag<&Flags::trivially_destructible>(p1));
+    ASSERT_FALSE(Helper::has_lifetime_flag<&Flags::trivially_copyable>(p2));
+    ASSERT_FALSE(Helper::has_lifetime_flag<&Flags::trivially_relocatable>(p2));
+    ASSERT_FALSE(
+        Helper::has_lifetime_flag<&Flags::trivially_destructible>(p2));
+    pro::proxy<details::TestNontrivialFacade> p3 = p1;
+    pro::proxy<details::TestNontrivialFacade> p4 = std::move(p1);
+    ASSERT_FALSE(p1.has_value());
+    ASSERT_EQ(ToString(*p3), "Session 1");
+    ASSERT_EQ(ToString(*p4), "Session 1");
+    p3.reset();
+    ASSERT_FALSE(p3.has_value());
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+    pro::proxy<details::TestNontrivialFacade> p5 = std::move(p2);
+    ASSERT_FALSE(p2.has_value());
+    ASSERT_EQ(ToString(*p5), "Session 3");
+    expected_ops.emplace_back(3,
+                              utils::LifetimeOperationType::kMoveConstruction);
+    expected_ops.emplace_back(2, utils::LifetimeOperationType::kDestruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+
+    // The bulk algorithms consult the flags as well, element by element
+    std::allocator<Proxy> alloc;
+    Proxy* a = alloc.allocate(3u);
+    Proxy* b = alloc.allocate(3u);
+    std::construct_at(a, p4);
+    std::construct_at(a + 1);
+    std::construct_at(a + 2, p5);
+    expected_ops.emplace_back(4,
+                              utils::LifetimeOperationType::kCopyConstruction);
+    pro::uninitialized_relocate_n(a, 3u, b);
+    expected_ops.emplace_back(5,
+                              utils::LifetimeOperationType::kMoveConstruction);
+    expected_ops.emplace_back(4, utils::LifetimeOperationType::kDestruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+    pro::uninitialized_copy_n(b, 3u, a);
+    expected_ops.emplace_back(6,
+                              utils::LifetimeOperationType::kCopyConstruction);
+    ASSERT_EQ(ToString(*a[0]), "Session 1");
+    ASSERT_FALSE(a[1].has_value());
+    ASSERT_EQ(ToString(*a[2]), "Session 6");
+    pro::destroy_n(a, 3u);
+    expected_ops.emplace_back(6, utils::LifetimeOperationType::kDestruction);
+    pro::destroy_n(b, 3u);
+    expected_ops.emplace_back(5, utils::LifetimeOperationType::kDestruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+    alloc.deallocate(a, 3u);
+    alloc.deallocate(b, 3u);
+  }
+  expected_ops.emplace_back(3, utils::LifetimeOperationType::kDestruction);
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
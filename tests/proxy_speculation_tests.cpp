@@ -0,0 +1,159 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "utils.h"
+#include <gtest/gtest.h>
+#include <iterator>
+#include <proxy/proxy.h>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace proxy_speculation_tests_details {
+
+PRO_DEF_MEM_DISPATCH(MemArea, Area);
+
+struct Shape : pro::facade_builder                                //
+               ::add_convention<MemArea, double() const noexcept> //
+               ::build {};
+
+struct Square {
+  double Area() const noexcept { return side * side; }
+  double side;
+};
+
+struct Circle {
+  double Area() const noexcept { return 3.0 * radius * radius; }
+  double radius;
+};
+
+struct LargeSquare {
+  double Area() const noexcept { return side * side; }
+  double side;
+  void* padding[4]{};
+};
+
+struct SpeculativeShape
+    : pro::facade_builder                                                     //
+      ::add_facade<Shape>                                                     //
+      ::add_skill<pro::skills::speculate, Square, LargeSquare, const Circle*> //
+      ::build {};
+
+struct TypeListSpeculativeShape
+    : pro::facade_builder                                             //
+      ::add_facade<Shape>                                             //
+      ::add_skill<pro::skills::speculate, std::tuple<Square, Circle>> //
+      ::build {};
+
+struct ProfiledShape : pro::facade_builder                           //
+                       ::add_facade<Shape>                           //
+                       ::add_skill<pro::skills::profile_speculation> //
+                       ::build {};
+
+// Copyability and RTTI make the meta too large to be embedded, so that it is
+// pooled.
+struct PooledSpeculativeShape
+    : pro::facade_builder                                        //
+      ::add_facade<Shape>                                        //
+      ::support_copy<pro::constraint_level::nothrow>             //
+      ::add_skill<pro::skills::rtti>                             //
+      ::add_skill<pro::skills::pooled_meta>                      //
+      ::add_skill<pro::skills::speculate, Square, const Circle*> //
+      ::build {};
+
+struct SpeculativeStringable
+    : pro::facade_builder                                                  //
+      ::add_facade<utils::spec::Stringable>                                //
+      ::add_skill<pro::skills::speculate, utils::LifetimeTracker::Session> //
+      ::build {};
+
+static_assert(sizeof(pro::proxy<SpeculativeShape>) ==
+              sizeof(pro::proxy<Shape>));
+
+template <class F>
+std::vector<double> GetAreas(const std::vector<pro::proxy<F>>& shapes) {
+  std::vector<double> result;
+  for (auto& shape : shapes) {
+    result.push_back(shape->Area());
+  }
+  return result;
+}
+
+} // namespace proxy_speculation_tests_details
+
+namespace details = proxy_speculation_tests_details;
+
+TEST(ProxySpeculationTests, TestSpeculate) {
+  details::Square square{5.0};
+  details::Circle circle{1.0};
+  std::vector<pro::proxy<details::SpeculativeShape>> shapes;
+  shapes.push_back(
+      pro::make_proxy<details::SpeculativeShape>(details::Square{2.0}));
+  shapes.push_back(
+      pro::make_proxy<details::SpeculativeShape>(details::Circle{2.0}));
+  shapes.push_back(
+      pro::make_proxy<details::SpeculativeShape>(details::LargeSquare{3.0}));
+  shapes.push_back(&square);
+  shapes.push_back(static_cast<const details::Circle*>(&circle));
+  ASSERT_EQ(details::GetAreas(shapes),
+            (std::vector<double>{4.0, 12.0, 9.0, 25.0, 3.0}));
+}
+
+TEST(ProxySpeculationTests, TestSpeculate_TypeList) {
+  std::vector<pro::proxy<details::TypeListSpeculativeShape>> shapes;
+  shapes.push_back(pro::make_proxy<details::TypeListSpeculativeShape>(
+      details::Circle{1.0}));
+  shapes.push_back(pro::make_proxy<details::TypeListSpeculativeShape>(
+      details::Square{3.0}));
+  ASSERT_EQ(details::GetAreas(shapes), (std::vector<double>{3.0, 9.0}));
+}
+
+TEST(ProxySpeculationTests, TestSpeculate_Pooled) {
+  std::vector<pro::proxy<details::PooledSpeculativeShape>> shapes;
+  shapes.push_back(
+      pro::make_proxy<details::PooledSpeculativeShape>(details::Circle{1.0}));
+  shapes.push_back(
+      pro::make_proxy<details::PooledSpeculativeShape>(details::Square{2.0}));
+  ASSERT_EQ(details::GetAreas(shapes), (std::vector<double>{3.0, 4.0}));
+
+  // Speculating a type that has never been stored does not pool a meta for it
+  using MetaPtr = pro::details::facade_meta_ptr_traits<
+      details::PooledSpeculativeShape>::type;
+  ASSERT_EQ(MetaPtr::registry::find<const details::Circle*>(), nullptr);
+}
+
+TEST(ProxySpeculationTests, TestSpeculate_Lifetime) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p = pro::make_proxy<details::SpeculativeStringable,
+                             utils::LifetimeTracker::Session>(&tracker);
+    expected_ops.emplace_back(1,
+                              utils::LifetimeOperationType::kValueConstruction);
+    ASSERT_EQ(ToString(*p), "Session 1");
+    ASSERT_EQ(tracker.GetOperations(), expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_EQ(tracker.GetOperations(), expected_ops);
+}
+
+TEST(ProxySpeculationTests, TestProfileSpeculation) {
+  std::vector<pro::proxy<details::ProfiledShape>> shapes;
+  for (int i = 0; i < 3; ++i) {
+    shapes.push_back(
+        pro::make_proxy<details::ProfiledShape>(details::Circle{1.0}));
+  }
+  details::Square square{2.0};
+  shapes.push_back(&square);
+  ASSERT_EQ(details::GetAreas(shapes),
+            (std::vector<double>{3.0, 3.0, 3.0, 4.0}));
+
+  std::string profile;
+  pro::write_speculation_profile(std::back_inserter(profile));
+  ASSERT_NE(profile.find("#pragma once"), std::string::npos);
+  ASSERT_NE(profile.find("ProfiledShape"), std::string::npos);
+  ASSERT_NE(profile.find("Circle (3)"), std::string::npos);
+  ASSERT_NE(profile.find("Square* (1)"), std::string::npos);
+  ASSERT_NE(profile.find("ProfiledShape_speculation = std::tuple<"),
+            std::string::npos);
+}
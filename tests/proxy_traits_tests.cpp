@@ -428,6 +428,52 @@ struct BigFacade : pro::facade_builder                                //
 static_assert(sizeof(pro::proxy<BigFacade>) ==
               3 * sizeof(void*)); // Accessors should not add paddings
 
+struct InlineMetaBigFacade : pro::facade_builder     //
+                             ::add_facade<BigFacade> //
+                             ::inline_meta<9>        //
+                             ::build {};
+static_assert(sizeof(pro::proxy<InlineMetaBigFacade>) ==
+              11 * sizeof(void*)); // All 9 dispatchers should be embedded
+struct InsufficientInlineMetaBigFacade : pro::facade_builder     //
+                                         ::add_facade<BigFacade> //
+                                         ::inline_meta<8>        //
+                                         ::build {};
+static_assert(sizeof(pro::proxy<InsufficientInlineMetaBigFacade>) ==
+              3 * sizeof(void*));
+struct HotBigFacade : pro::facade_builder                                    //
+                      ::add_facade<BigFacade>                                //
+                      ::add_hot_convention<MemFoo, void()>                   //
+                      ::add_hot_direct_convention<MemBar, void(), void(int)> //
+                      ::build {};
+static_assert(sizeof(pro::proxy<HotBigFacade>) ==
+              6 * sizeof(void*)); // 3 hot dispatchers + cold meta pointer
+struct HotInlineMetaBigFacade : pro::facade_builder        //
+                                ::add_facade<HotBigFacade> //
+                                ::inline_meta<9>           //
+                                ::build {};
+static_assert(sizeof(pro::proxy<HotInlineMetaBigFacade>) ==
+              11 * sizeof(void*)); // Embedding the whole meta takes priority
+
+struct TaggedFacade : pro::facade_builder              //
+                      ::add_skill<pro::skills::tagged> //
+                      ::build {};
+static_assert(sizeof(pro::proxy<TaggedFacade>) == sizeof(void*));
+static_assert(pro::proxiable<double*, TaggedFacade>);
+static_assert(!pro::proxiable<int*, TaggedFacade>); // Insufficient alignment
+static_assert(!pro::proxiable<std::unique_ptr<int>, TaggedFacade>);
+static_assert(pro::proxiable<std::unique_ptr<double>, TaggedFacade>);
+static_assert(!pro::proxiable<std::shared_ptr<int>, TaggedFacade>);
+static_assert(!pro::inplace_proxiable_target<double, TaggedFacade>);
+
+struct EmptyPolicy {};
+struct StatelessFacade : pro::facade_builder                 //
+                         ::add_skill<pro::skills::stateless> //
+                         ::build {};
+static_assert(sizeof(pro::proxy<StatelessFacade>) == sizeof(void*));
+static_assert(pro::inplace_proxiable_target<EmptyPolicy, StatelessFacade>);
+static_assert(!pro::inplace_proxiable_target<int, StatelessFacade>);
+static_assert(!pro::proxiable<double*, StatelessFacade>);
+
 struct FacadeWithSizeOfNonPowerOfTwo : pro::facade_builder   //
                                        ::restrict_layout<6u> //
                                        ::build {};
@@ -0,0 +1,60 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+// Writes the speculation profile of types that cannot be named in a header
+// together with one that can, to the file named by the first argument.
+
+#include "shapes.h"
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+namespace {
+
+struct Circle {
+  double Area() const noexcept { return 3.0 * radius * radius; }
+  double radius;
+};
+
+} // namespace
+
+template <class T>
+struct Scaled {
+  double Area() const noexcept { return scale(); }
+  T scale;
+};
+
+int main(int argc, char** argv) {
+  if (argc != 2) {
+    return 1;
+  }
+  struct Triangle {
+    double Area() const noexcept { return base * height / 2.0; }
+    double base, height;
+  };
+  auto scale = [] { return 2.0; };
+  std::vector<pro::proxy<ProfiledShape>> shapes;
+  for (int i = 0; i < 40; ++i) {
+    shapes.push_back(pro::make_proxy<ProfiledShape>(Circle{1.0}));
+  }
+  for (int i = 0; i < 30; ++i) {
+    shapes.push_back(pro::make_proxy<ProfiledShape>(Triangle{1.0, 2.0}));
+  }
+  for (int i = 0; i < 20; ++i) {
+    shapes.push_back(
+        pro::make_proxy<ProfiledShape>(Scaled<decltype(scale)>{scale}));
+  }
+  for (int i = 0; i < 10; ++i) {
+    shapes.push_back(pro::make_proxy<ProfiledShape>(Square{2.0}));
+  }
+  double total = 0.0;
+  for (auto& shape : shapes) {
+    total += shape->Area();
+  }
+  if (total != 40 * 3.0 + 30 * 1.0 + 20 * 2.0 + 10 * 4.0) {
+    return 1;
+  }
+  std::ofstream out{argv[1]};
+  pro::write_speculation_profile(std::ostreambuf_iterator<char>{out});
+  return out ? 0 : 1;
+}
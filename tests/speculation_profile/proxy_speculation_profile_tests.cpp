@@ -0,0 +1,24 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+// Compiles the header written by generator.cpp, which only names the types
+// that can be named outside of the generator.
+
+#include "shapes.h"
+#include <speculation_profile.h>
+#include <tuple>
+#include <type_traits>
+
+static_assert(std::is_same_v<ProfiledShape_speculation, std::tuple<Square>>);
+
+struct SpeculativeShape
+    : pro::facade_builder                                            //
+      ::add_facade<Shape>                                            //
+      ::add_skill<pro::skills::speculate, ProfiledShape_speculation> //
+      ::build {};
+
+int main() {
+  pro::proxy<SpeculativeShape> p =
+      pro::make_proxy<SpeculativeShape>(Square{3.0});
+  return p->Area() == 9.0 ? 0 : 1;
+}
@@ -0,0 +1,25 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#ifndef _MSFT_PROXY_SPECULATION_PROFILE_SHAPES_
+#define _MSFT_PROXY_SPECULATION_PROFILE_SHAPES_
+
+#include <proxy/proxy.h>
+
+PRO_DEF_MEM_DISPATCH(MemArea, Area);
+
+struct Shape : pro::facade_builder                                //
+               ::add_convention<MemArea, double() const noexcept> //
+               ::build {};
+
+struct ProfiledShape : pro::facade_builder                           //
+                       ::add_facade<Shape>                           //
+                       ::add_skill<pro::skills::profile_speculation> //
+                       ::build {};
+
+struct Square {
+  double Area() const noexcept { return side * side; }
+  double side;
+};
+
+#endif // _MSFT_PROXY_SPECULATION_PROFILE_SHAPES_